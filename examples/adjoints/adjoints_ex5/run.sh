@@ -13,6 +13,8 @@ example_dir=examples/adjoints/$example_name
 run_example "$example_name" n_timesteps=10 timesolver_tolerance=0.0 timesolver_upper_tolerance=0.0 solution_history_type=memory
 # Save previous timestep solution on disk
 run_example "$example_name" n_timesteps=10 timesolver_tolerance=0.0 timesolver_upper_tolerance=0.0 solution_history_type=file
+# Save a few previous timestep solutions in memory and recompute the rest
+run_example "$example_name" n_timesteps=10 timesolver_tolerance=0.0 timesolver_upper_tolerance=0.0 solution_history_type=checkpoint
 
 # Adaptive time stepping
 # Save previous timestep solution in memory
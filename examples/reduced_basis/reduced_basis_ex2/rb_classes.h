@@ -73,6 +73,12 @@ public:
     return rb_scm_eval->get_SCM_LB();
   }
 
+  /**
+   * We override nothing which batched RB solves bypass, so the
+   * greedy may solve the training set in threaded batches.
+   */
+  virtual bool supports_batch_rb_solve() const { return true; }
+
   /**
    * Pointer to the SCM object that will provide our coercivity constant lower bound.
    */
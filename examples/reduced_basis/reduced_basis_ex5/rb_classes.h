@@ -35,6 +35,12 @@ public:
    */
   virtual Real get_stability_lower_bound() { return 1.; }
 
+  /**
+   * We override nothing which batched RB solves bypass, so the
+   * greedy may solve the training set in threaded batches.
+   */
+  virtual bool supports_batch_rb_solve() const { return true; }
+
   /**
    * The object that stores the "theta" expansion of the parameter dependent PDE,
    * i.e. the set of parameter-dependent functions in the affine expansion of the PDE.
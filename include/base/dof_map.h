@@ -71,6 +71,8 @@ class NonlinearImplicitSystem;
 template <typename T> class DenseVectorBase;
 template <typename T> class DenseVector;
 template <typename T> class DenseMatrix;
+template <typename T, unsigned int N> class FixedDenseVector;
+template <typename T, unsigned int M, unsigned int N> class FixedDenseMatrix;
 template <typename T> class SparseMatrix;
 template <typename T> class NumericVector;
 
@@ -256,6 +258,39 @@ public:
    */
   void clear_sparsity();
 
+  /**
+   * Builds a sparsity pattern for the current mesh and dof
+   * distribution, without storing it or sending it to any matrix.
+   * The full graph of each local row is computed if
+   * \p calculate_full_pattern is \p true or if any attached matrix
+   * needs it; otherwise only the row counts are reliable.
+   */
+  std::unique_ptr<SparsityPattern::Build>
+  build_sparsity(const MeshBase & mesh,
+                 bool calculate_full_pattern = false) const;
+
+  /**
+   * Marks the local dofs which are interior to a single element:
+   * the unconstrained dofs of continuous variables which are stored
+   * on an active local element itself, or on one of its nodes which
+   * lies on none of its sides.  Such dofs couple only to the other
+   * dofs of their element, so they can be eliminated element by
+   * element with static condensation.  Nothing is marked if
+   * neighboring elements' dofs are coupled, and nothing is marked on
+   * an element which any coupling functor couples to another
+   * element, in either direction.
+   *
+   * This should be called on all processors, after constraints are
+   * processed.  The marks are discarded when dofs are redistributed.
+   */
+  void mark_interior_dofs ();
+
+  /**
+   * \returns \p true if \p dof was marked by \p mark_interior_dofs().
+   * Dofs owned by other processors are never marked.
+   */
+  bool is_interior_dof (const dof_id_type dof) const;
+
   /**
    * Remove any default ghosting functor(s).  User-added ghosting
    * functors will be unaffected.
@@ -521,6 +556,13 @@ public:
     return *_n_oz;
   }
 
+  /**
+   * \returns \p true if the sparsity has been computed, so that
+   * \p get_n_nz() and \p get_n_oz() may be called.
+   */
+  bool has_n_nz_n_oz() const
+  { return _n_nz && _n_oz; }
+
   // /**
   //  * Add an unknown of order \p order and finite element type
   //  * \p type to the system of equations.
@@ -1137,6 +1179,47 @@ public:
                                             std::vector<dof_id_type> & elem_dofs,
                                             bool asymmetric_constraint_rows = true) const;
 
+  /**
+   * Constrains the fixed-size element matrix \p matrix.  Constraints
+   * may couple an element to dofs outside it, which a fixed-size
+   * matrix has no room for, so if any of \p elem_dofs is constrained
+   * then \p matrix is copied into \p constrained_matrix, which is
+   * constrained (and \p elem_dofs expanded) as usual, and \p true is
+   * returned.  Otherwise \p false is returned, nothing is changed,
+   * and \p matrix can be used as is.
+   */
+  template <unsigned int N>
+  bool constrain_element_matrix (const FixedDenseMatrix<Number,N,N> & matrix,
+                                 std::vector<dof_id_type> & elem_dofs,
+                                 DenseMatrix<Number> & constrained_matrix,
+                                 bool asymmetric_constraint_rows = true) const
+  {
+    return this->constrain_fixed_element_system
+      (matrix.data(), nullptr, elem_dofs, &constrained_matrix, nullptr,
+       asymmetric_constraint_rows);
+  }
+
+  /**
+   * Constrains the fixed-size element matrix \p matrix and vector
+   * \p rhs.  As above, if any of \p elem_dofs is constrained then
+   * they are copied into \p constrained_matrix and
+   * \p constrained_rhs, which are constrained as usual, and \p true
+   * is returned; otherwise \p false is returned and nothing is
+   * changed.
+   */
+  template <unsigned int N>
+  bool constrain_element_matrix_and_vector (const FixedDenseMatrix<Number,N,N> & matrix,
+                                            const FixedDenseVector<Number,N> & rhs,
+                                            std::vector<dof_id_type> & elem_dofs,
+                                            DenseMatrix<Number> & constrained_matrix,
+                                            DenseVector<Number> & constrained_rhs,
+                                            bool asymmetric_constraint_rows = true) const
+  {
+    return this->constrain_fixed_element_system
+      (matrix.data(), rhs.data(), elem_dofs, &constrained_matrix,
+       &constrained_rhs, asymmetric_constraint_rows);
+  }
+
   /**
    * Constrains the element matrix and vector.  This method requires
    * the element matrix to be square, in which case the elem_dofs
@@ -1410,6 +1493,15 @@ public:
    */
   std::string get_info() const;
 
+  /**
+   * \returns An estimate of the memory, in bytes, used on this
+   * processor by the degree of freedom bookkeeping, the constraints,
+   * and any sparsity pattern still held.  The indices stored on the
+   * mesh's \p DofObjects are counted by \p MeshBase::memory_usage()
+   * instead.
+   */
+  std::size_t memory_usage() const;
+
   /**
    * Degree of freedom coupling.  If left empty each DOF
    * couples to all others.  Can be used to reduce memory
@@ -1466,11 +1558,6 @@ private:
                           std::vector<dof_id_type> & di,
                           const unsigned int vn) const;
 
-  /**
-   * Builds a sparsity pattern
-   */
-  std::unique_ptr<SparsityPattern::Build> build_sparsity(const MeshBase & mesh) const;
-
   /**
    * Invalidates all active DofObject dofs for this system
    */
@@ -1588,6 +1675,19 @@ private:
    */
   void find_connected_dofs (std::vector<dof_id_type> & elem_dofs) const;
 
+  /**
+   * Helper for constraining fixed-size element matrices and vectors,
+   * stored contiguously (the matrix in row-major order) at \p matrix
+   * and \p rhs; either may be null if only the other is being
+   * constrained.
+   */
+  bool constrain_fixed_element_system (const Number * matrix,
+                                       const Number * rhs,
+                                       std::vector<dof_id_type> & elem_dofs,
+                                       DenseMatrix<Number> * constrained_matrix,
+                                       DenseVector<Number> * constrained_rhs,
+                                       bool asymmetric_constraint_rows) const;
+
   /**
    * Finds all the DofObjects associated with the set in \p objs.
    * This will account for off-element couplings via hanging nodes.
@@ -1753,6 +1853,13 @@ private:
    */
   std::unique_ptr<SparsityPattern::Build> _sp;
 
+  /**
+   * Flags, for each local dof, whether it is interior to a single
+   * element.  Empty unless \p mark_interior_dofs() has been called
+   * since dofs were last distributed.
+   */
+  std::vector<bool> _interior_dofs;
+
   /**
    * The number of on-processor nonzeros in my portion of the
    * global matrix.  If need_full_sparsity_pattern is true, this will
@@ -1950,6 +2057,16 @@ bool DofMap::is_constrained_node (const Node *
 }
 
 
+inline
+bool DofMap::is_interior_dof (const dof_id_type dof) const
+{
+  if (_interior_dofs.empty() || !this->local_index(dof))
+    return false;
+
+  return _interior_dofs[dof - this->first_dof()];
+}
+
+
 inline
 bool DofMap::is_constrained_dof (const dof_id_type dof) const
 {
@@ -2028,6 +2145,13 @@ inline void DofMap::constrain_element_matrix_and_vector (DenseMatrix<Number> &,
                                                          std::vector<dof_id_type> &,
                                                          bool) const {}
 
+inline bool DofMap::constrain_fixed_element_system (const Number *,
+                                                    const Number *,
+                                                    std::vector<dof_id_type> &,
+                                                    DenseMatrix<Number> *,
+                                                    DenseVector<Number> *,
+                                                    bool) const { return false; }
+
 inline void DofMap::heterogenously_constrain_element_matrix_and_vector
   (DenseMatrix<Number> &, DenseVector<Number> &,
    std::vector<dof_id_type> &, bool, int) const {}
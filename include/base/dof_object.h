@@ -465,6 +465,12 @@ public:
    */
   void pack_indexing(std::back_insert_iterator<std::vector<largest_id_type>> target) const;
 
+  /**
+   * \returns The heap memory, in bytes, held by our index buffer and
+   * by any copy of this object on the last mesh.
+   */
+  std::size_t heap_memory_usage () const;
+
   /**
    * Print our buffer for debugging.
    */
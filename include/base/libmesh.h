@@ -228,7 +228,9 @@ extern const Number imaginary;
  * The command-line is also checked, allowing the user to override the
  * compiled default.  For example, \p --use-petsc will force the use of
  * PETSc solvers, and \p --use-laspack will force the use of LASPACK
- * solvers.
+ * solvers.  The solvers built into libMesh itself, which only
+ * provide CG, are never the default; they are used only if selected
+ * with \p --use-native-solvers.
  */
 SolverPackage default_solver_package ();
 
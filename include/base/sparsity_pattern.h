@@ -128,6 +128,12 @@ public:
   void join (const Build & other);
 
   void parallel_sync ();
+
+  /**
+   * \returns An estimate of the memory, in bytes, used by the
+   * sparsity pattern built so far on this thread and processor.
+   */
+  std::size_t memory_usage () const;
 };
 
 #if defined(__GNUC__) && (__GNUC__ < 4) && !defined(__INTEL_COMPILER)
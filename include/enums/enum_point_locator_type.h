@@ -36,6 +36,8 @@ enum PointLocatorType : int {
                        TREE = 0,
                        TREE_ELEMENTS,
                        TREE_LOCAL_ELEMENTS,
+                       BVH,
+                       BVH_LOCAL_ELEMENTS,
                        // Invalid
                        INVALID_LOCATOR};
 }
@@ -50,6 +50,7 @@ enum SolverType : int {
                  RICHARDSON,
                  CHEBYSHEV,
                  SPARSELU,
+                 PIPECG,
                  // Invalid
                  INVALID_SOLVER};
 }
@@ -647,6 +647,19 @@ protected:
    */
   bool shapes_on_quadrature;
 
+  /**
+   * \returns Side \p s of \p elem, built into a side element kept
+   * from an earlier call when one of the right type exists, so that
+   * reinitializing on sides doesn't allocate.  The side is valid
+   * until the next call which builds a side of the same type.
+   */
+  const Elem * cached_side (const Elem * elem, const unsigned int s);
+
+  /**
+   * The side elements of each type built by \p cached_side().
+   */
+  std::vector<std::unique_ptr<Elem>> _cached_sides;
+
   /**
    * \returns \p true when the shape functions (for
    * this \p FEFamily) depend on the particular
@@ -180,6 +180,9 @@ public:
    * extra_checks == true *and* compiled in DEBUG mode:
    * .) Print a warning if p != map(inverse_map(p)) to within tolerance.
    * .) Print a warning if the inverse-mapped point is not on the reference element to within tolerance.
+   *
+   * Elements with an affine Lagrange map are inverted directly,
+   * without any Newton iteration.
    */
   static Point inverse_map (const unsigned int dim,
                             const Elem * elem,
@@ -195,6 +198,11 @@ public:
    * reference element are returned in the vector \p
    * reference_points. The other parameters have the same meaning
    * as the single Point version of inverse_map() above.
+   *
+   * Affine maps are inverted once and applied to every point; for
+   * other maps the Newton iteration is carried out on all
+   * unconverged points together, so that each iteration visits the
+   * element's mapping nodes only once.
    */
   static void inverse_map (unsigned int dim,
                            const Elem * elem,
@@ -167,6 +167,11 @@ public:
   virtual void build_side_ptr (std::unique_ptr<Elem> & elem,
                                const unsigned int i) override;
 
+  /**
+   * \returns \p QUAD8.
+   */
+  virtual ElemType side_type (const unsigned int s) const override;
+
   /**
    * Builds a \p EDGE3 built coincident with edge i.
    * The \p std::unique_ptr<Elem> handles the memory aspect.
@@ -140,6 +140,11 @@ public:
   virtual void build_side_ptr (std::unique_ptr<Elem> & elem,
                                const unsigned int i) override;
 
+  /**
+   * \returns \p QUAD4.
+   */
+  virtual ElemType side_type (const unsigned int s) const override;
+
   /**
    * Builds a EDGE2 built coincident with edge i.
    * The \p std::unique_ptr<Elem> handles the memory aspect.
@@ -154,6 +154,12 @@ public:
   virtual void build_side_ptr (std::unique_ptr<Elem> & elem,
                                const unsigned int i) override;
 
+  /**
+   * \returns \p QUAD9 for the base face and \p INFQUAD6 for the
+   * infinite faces.
+   */
+  virtual ElemType side_type (const unsigned int s) const override;
+
   /**
    * \returns An \p EDGE3 built coincident with edges 0-3, or an \p INFEDGE2
    * built coincident with edges 4 to 11.
@@ -143,6 +143,12 @@ public:
   virtual void build_side_ptr (std::unique_ptr<Elem> & elem,
                                const unsigned int i) override;
 
+  /**
+   * \returns \p TRI3 for the base face and \p INFQUAD4 for the
+   * infinite faces.
+   */
+  virtual ElemType side_type (const unsigned int s) const override;
+
   /**
    * \returns An \p EDGE2 built coincident with edges 0 to 2, an \p INFEDGE2
    * built coincident with edges 3 to 5.
@@ -168,6 +168,12 @@ public:
   virtual void build_side_ptr (std::unique_ptr<Elem> & elem,
                                const unsigned int i) override;
 
+  /**
+   * \returns \p TRI6 for the triangular faces and \p QUAD8 for the
+   * quadrilateral faces.
+   */
+  virtual ElemType side_type (const unsigned int s) const override;
+
   /**
    * Builds a \p EDGE3 or \p INFEDGE2 coincident with edge i.
    * The \p std::unique_ptr<Elem> handles the memory aspect.
@@ -134,6 +134,12 @@ public:
   virtual void build_side_ptr (std::unique_ptr<Elem> & elem,
                                const unsigned int i) override;
 
+  /**
+   * \returns \p TRI3 for the triangular faces and \p QUAD4 for the
+   * quadrilateral faces.
+   */
+  virtual ElemType side_type (const unsigned int s) const override;
+
   /**
    * Builds a \p EDGE2 or \p INFEDGE2 built coincident with face i.
    * The \p std::unique_ptr<Elem> handles the memory aspect.
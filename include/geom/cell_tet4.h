@@ -153,6 +153,11 @@ public:
   virtual void build_side_ptr (std::unique_ptr<Elem> & elem,
                                const unsigned int i) override;
 
+  /**
+   * \returns \p TRI3.
+   */
+  virtual ElemType side_type (const unsigned int s) const override;
+
   /**
    * Builds a \p EDGE2 built coincident with face i.
    * The \p std::unique_ptr<Elem> handles the memory aspect.
@@ -168,6 +168,11 @@ public:
   virtual void build_side_ptr (std::unique_ptr<Elem> & elem,
                                const unsigned int i) override final;
 
+  /**
+   * \returns \p NODEELEM.
+   */
+  virtual ElemType side_type (const unsigned int s) const override final;
+
   /**
    * The \p Elem::build_edge_ptr() member makes no sense for edges.
    */
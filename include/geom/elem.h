@@ -851,6 +851,13 @@ public:
   virtual void build_side_ptr (std::unique_ptr<Elem> & side, const unsigned int i) = 0;
   void build_side_ptr (std::unique_ptr<const Elem> & side, const unsigned int i) const;
 
+  /**
+   * \returns The type of the element \p build_side_ptr(i) would
+   * build, without building it.  This lets callers choose a cached
+   * side element of the right type, or size a \p ElemSideView.
+   */
+  virtual ElemType side_type (const unsigned int i) const = 0;
+
   /**
    * \returns An element coincident with edge \p i wrapped in a smart pointer.
    *
@@ -982,6 +989,15 @@ public:
    */
   std::string get_info () const;
 
+  /**
+   * \returns An estimate of the memory, in bytes, used by this element:
+   * the element itself, the node and neighbor pointers which most
+   * element types store alongside it, its array of children and its
+   * degree of freedom indexing.  The nodes and children themselves
+   * are not included.
+   */
+  std::size_t memory_usage () const;
+
   /**
    * \returns \p true if the element is active (i.e. has no active
    * descendants) or AMR is disabled, \p false otherwise.
@@ -0,0 +1,171 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ELEM_SIDE_VIEW_H
+#define LIBMESH_ELEM_SIDE_VIEW_H
+
+// Local includes
+#include "libmesh/elem.h"
+
+// C++ includes
+#include <array>
+
+namespace libMesh
+{
+
+/**
+ * A lightweight view of one side or edge of an element, which lives
+ * on the stack.  It gives access to the nodes of the side in the
+ * order \p Elem::build_side_ptr() or \p Elem::build_edge_ptr() would
+ * put them, along with the type, centroid and key of the side, without
+ * allocating a side element.
+ *
+ * Code which only needs the nodes of a side, e.g. to compare sides,
+ * find their centroids or look up their keys, should prefer this to
+ * building a side element.  Code which needs a real \p Elem, e.g. to
+ * reinitialize an FE object on it, still has to build one.
+ *
+ * A view refers to its element, and must not outlive it.
+ *
+ * \brief A view of the nodes of an element side or edge.
+ */
+class ElemSideView
+{
+public:
+
+  /**
+   * Constructor.  Views side \p s of \p elem.
+   */
+  ElemSideView (const Elem & elem, const unsigned int s);
+
+  /**
+   * \returns A view of edge \p e of \p elem.  For 2D elements the
+   * edges are the sides.
+   */
+  static ElemSideView edge (const Elem & elem, const unsigned int e);
+
+  /**
+   * The largest number of nodes on any side, that of a \p QUAD9.
+   */
+  static const unsigned int max_n_nodes = 9;
+
+  /**
+   * \returns The element this views a side of.
+   */
+  const Elem & parent () const { return _elem; }
+
+  /**
+   * \returns The index of the side or edge in the parent.
+   */
+  unsigned int index () const { return _index; }
+
+  /**
+   * \returns \p true if this views an edge rather than a side.
+   */
+  bool is_edge () const { return _is_edge; }
+
+  /**
+   * \returns The type of the element this side would be built as.
+   */
+  ElemType type () const { return _type; }
+
+  /**
+   * \returns The number of nodes on the side.
+   */
+  unsigned int n_nodes () const { return _n_nodes; }
+
+  /**
+   * \returns The local index in the parent of node \p n of the side.
+   */
+  unsigned int local_node (const unsigned int n) const
+  {
+    libmesh_assert_less (n, _n_nodes);
+    return _local_nodes[n];
+  }
+
+  /**
+   * \returns A pointer to node \p n of the side.
+   */
+  const Node * node_ptr (const unsigned int n) const
+  { return _elem.node_ptr(this->local_node(n)); }
+
+  /**
+   * \returns A reference to node \p n of the side.
+   */
+  const Node & node_ref (const unsigned int n) const
+  { return _elem.node_ref(this->local_node(n)); }
+
+  /**
+   * \returns The global id of node \p n of the side.
+   */
+  dof_id_type node_id (const unsigned int n) const
+  { return _elem.node_id(this->local_node(n)); }
+
+  /**
+   * \returns The location of node \p n of the side.
+   */
+  const Point & point (const unsigned int n) const
+  { return _elem.point(this->local_node(n)); }
+
+  /**
+   * \returns The key of the side, the same as that of the side
+   * element.  Only sides have keys.
+   */
+  dof_id_type key () const;
+
+  /**
+   * \returns The average of the vertices of the side, the same as the
+   * centroid of the side element.
+   */
+  Point centroid () const;
+
+  /**
+   * \returns \p true if the side has the same vertices as \p other,
+   * in any order.
+   */
+  bool same_vertices (const ElemSideView & other) const;
+
+private:
+
+  /**
+   * Fills the nodes of edge \p e.
+   */
+  ElemSideView (const Elem & elem, const unsigned int e, bool);
+
+  const Elem & _elem;
+
+  unsigned int _index;
+
+  bool _is_edge;
+
+  ElemType _type;
+
+  unsigned char _n_nodes;
+
+  /**
+   * The number of vertices, which come first.
+   */
+  unsigned char _n_vertices;
+
+  std::array<unsigned char, max_n_nodes> _local_nodes;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_ELEM_SIDE_VIEW_H
@@ -155,6 +155,12 @@ public:
   virtual void build_side_ptr (std::unique_ptr<Elem> & elem,
                                const unsigned int i) override;
 
+  /**
+   * \returns \p EDGE3 for the base side and \p INFEDGE2 for the
+   * infinite sides.
+   */
+  virtual ElemType side_type (const unsigned int s) const override;
+
   virtual void connectivity(const unsigned int sf,
                             const IOPackage iop,
                             std::vector<dof_id_type> & conn) const override;
@@ -155,6 +155,12 @@ public:
    */
   std::string get_info () const;
 
+  /**
+   * \returns The memory, in bytes, used by this node, including its
+   * degree of freedom indexing.
+   */
+  std::size_t memory_usage () const;
+
 #ifdef LIBMESH_HAVE_MPI
   unsigned int packed_size() const
   {
@@ -146,6 +146,9 @@ public:
   virtual void build_side_ptr (std::unique_ptr<Elem> &, const unsigned int) override
   { libmesh_not_implemented(); }
 
+  virtual ElemType side_type (const unsigned int) const override
+  { libmesh_not_implemented(); return INVALID_ELEM; }
+
   /**
    * The \p Elem::build_edge_ptr() member makes no sense for nodes.
    */
@@ -195,6 +195,9 @@ public:
                                const unsigned int) override
   { libmesh_not_implemented(); }
 
+  virtual ElemType side_type (const unsigned int) const override
+  { libmesh_not_implemented(); return INVALID_ELEM; }
+
   virtual std::unique_ptr<Elem> build_edge_ptr (const unsigned int) override
   { libmesh_not_implemented(); return std::unique_ptr<Elem>(); }
 
@@ -24,6 +24,7 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/id_types.h"
 #include "libmesh/parallel_object.h"
+#include "libmesh/flat_multimap.h"
 
 // C++ includes
 #include <cstddef>
@@ -99,6 +100,14 @@ public:
    */
   void regenerate_id_sets ();
 
+  /**
+   * Compacts the storage of the boundary ids added or removed since
+   * the last call.  Lookups are correct either way, but are fastest
+   * and use the least memory once finalized.  This is called by
+   * MeshBase::prepare_for_use().
+   */
+  void finalize ();
+
 
   /**
    * Generates \p boundary_mesh data structures corresponding to the
@@ -752,6 +761,12 @@ public:
    */
   void print_summary (std::ostream & out=libMesh::out) const;
 
+  /**
+   * \returns An estimate of the memory, in bytes, used by the boundary
+   * conditions and boundary names stored on this processor.
+   */
+  std::size_t memory_usage () const;
+
   /**
    * \returns A reference for getting an optional name for a sideset.
    */
@@ -844,31 +859,31 @@ private:
    * Data structure that maps nodes in the mesh
    * to boundary ids.
    */
-  std::multimap<const Node *,
-                boundary_id_type> _boundary_node_id;
+  FlatMultimap<const Node *,
+               boundary_id_type> _boundary_node_id;
 
   /**
    * Data structure that maps edges of elements
    * to boundary ids. This is only relevant in 3D.
    */
-  std::multimap<const Elem *,
-                std::pair<unsigned short int, boundary_id_type>>
+  FlatMultimap<const Elem *,
+               std::pair<unsigned short int, boundary_id_type>>
   _boundary_edge_id;
 
   /**
    * Data structure that maps faces of shell elements
    * to boundary ids. This is only relevant for shell elements.
    */
-  std::multimap<const Elem *,
-                std::pair<unsigned short int, boundary_id_type>>
+  FlatMultimap<const Elem *,
+               std::pair<unsigned short int, boundary_id_type>>
   _boundary_shellface_id;
 
   /**
    * Data structure that maps sides of elements
    * to boundary ids.
    */
-  std::multimap<const Elem *,
-                std::pair<unsigned short int, boundary_id_type>>
+  FlatMultimap<const Elem *,
+               std::pair<unsigned short int, boundary_id_type>>
   _boundary_side_id;
 
   /**
@@ -231,6 +231,7 @@ public:
   virtual void reserve_nodes (const dof_id_type) override {}
   virtual dof_id_type n_elem () const override { return _n_elem; }
   virtual dof_id_type n_active_elem () const override;
+  virtual std::size_t memory_usage () const override;
   virtual dof_id_type max_elem_id () const override { return _max_elem_id; }
   virtual void reserve_elem (const dof_id_type) override {}
 
@@ -1141,6 +1141,17 @@ public:
    */
   void print_info (std::ostream & os=libMesh::out) const;
 
+  /**
+   * \returns An estimate of the memory, in bytes, used on this
+   * processor by the elements and nodes it stores, the containers
+   * holding them, and the boundary information.  Point locators and
+   * ghosting functors are not included.
+   *
+   * Derived classes should add the memory used by their element and
+   * node containers.
+   */
+  virtual std::size_t memory_usage () const;
+
   /**
    * Equivalent to calling print_info() above, but now you can write:
    * Mesh mesh;
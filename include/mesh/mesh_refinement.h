@@ -538,6 +538,15 @@ private:
    */
   bool _refine_elements ();
 
+  /**
+   * Refines \p elems, which are flagged for refinement, with
+   * multiple threads.  The children and new nodes are given the same
+   * ids as refining each element in order would give them.  Only
+   * elements whose child nodes are all bracketed by their own nodes
+   * can be refined this way.
+   */
+  void _refine_elements_threaded (const std::vector<Elem *> & elems);
+
   /**
    * Smooths refinement flags according to current settings.  It is
    * possible that for a given set of refinement flags there is
@@ -120,6 +120,8 @@ public:
 
   virtual dof_id_type n_active_elem () const override;
 
+  virtual std::size_t memory_usage () const override;
+
   virtual dof_id_type max_elem_id () const override
   { return cast_int<dof_id_type>(_elements.size()); }
 
@@ -0,0 +1,162 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ASSEMBLY_BUFFER_H
+#define LIBMESH_ASSEMBLY_BUFFER_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+template <typename T> class SparseMatrix;
+template <typename T> class NumericVector;
+template <typename T> class DenseMatrix;
+template <typename T> class DenseVector;
+
+/**
+ * A thread-private staging area for contributions to a global
+ * SparseMatrix and/or NumericVector.
+ *
+ * Threaded assembly loops which add element matrices and vectors
+ * directly into shared global objects must serialize every insertion
+ * with a lock.  Instead, each thread can stage its contributions in
+ * its own AssemblyBuffer, which sums contributions to the same entry
+ * as they are flushed, and then takes the lock once per flush to
+ * insert everything in bulk through \p add_matrix() and
+ * \p add_vector().
+ *
+ * The buffer flushes itself whenever it holds more than capacity()
+ * entries; users must call flush() once they are done adding, and
+ * before the global objects are closed.
+ */
+template <typename T>
+class AssemblyBuffer
+{
+public:
+  /**
+   * Constructor.  Either of \p matrix or \p vector may be null, if
+   * no contributions to it will be added.  All buffers sharing the
+   * same global objects must use the same \p mutex.
+   */
+  AssemblyBuffer (SparseMatrix<T> * matrix,
+                  NumericVector<T> * vector,
+                  Threads::spin_mutex & mutex = Threads::spin_mtx);
+
+  /**
+   * Destructor.  All contributions should have been flushed.
+   */
+  ~AssemblyBuffer ();
+
+  /**
+   * Stages the element matrix \p Ke, with rows and columns both
+   * mapped by \p dof_indices.
+   */
+  void add_matrix (const DenseMatrix<T> & Ke,
+                   const std::vector<numeric_index_type> & dof_indices);
+
+  /**
+   * Stages the matrix \p Ke, with rows mapped by \p rows and columns
+   * mapped by \p cols.
+   */
+  void add_matrix (const DenseMatrix<T> & Ke,
+                   const std::vector<numeric_index_type> & rows,
+                   const std::vector<numeric_index_type> & cols);
+
+  /**
+   * Stages the element vector \p Fe, mapped by \p dof_indices.
+   */
+  void add_vector (const DenseVector<T> & Fe,
+                   const std::vector<numeric_index_type> & dof_indices);
+
+  /**
+   * Sums any staged contributions to the same entries, then adds
+   * them all to the global objects while holding the lock.
+   */
+  void flush ();
+
+  /**
+   * \returns \p true if no contributions are waiting to be flushed.
+   */
+  bool empty () const
+  { return _matrix_entries.empty() && _vector_entries.empty(); }
+
+  /**
+   * \returns The number of staged entries beyond which the buffer
+   * flushes itself.
+   */
+  std::size_t capacity () const { return _capacity; }
+
+  /**
+   * Sets the number of staged entries beyond which the buffer
+   * flushes itself.  Larger buffers take the lock less often and
+   * sum more duplicate entries, at the cost of memory.
+   */
+  void set_capacity (std::size_t capacity) { _capacity = capacity; }
+
+private:
+
+  /**
+   * A staged matrix entry.
+   */
+  struct MatrixEntry
+  {
+    numeric_index_type row, col;
+    T value;
+  };
+
+  /**
+   * A staged vector entry.
+   */
+  struct VectorEntry
+  {
+    numeric_index_type index;
+    T value;
+  };
+
+  /**
+   * Flushes if we've staged more than capacity() entries.
+   */
+  void flush_if_full ()
+  {
+    if (_matrix_entries.size() + _vector_entries.size() > _capacity)
+      this->flush();
+  }
+
+  SparseMatrix<T> * _matrix;
+  NumericVector<T> * _vector;
+  Threads::spin_mutex & _mutex;
+
+  std::vector<MatrixEntry> _matrix_entries;
+  std::vector<VectorEntry> _vector_entries;
+
+  std::size_t _capacity;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_ASSEMBLY_BUFFER_H
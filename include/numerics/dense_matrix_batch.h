@@ -0,0 +1,263 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_DENSE_MATRIX_BATCH_H
+#define LIBMESH_DENSE_MATRIX_BATCH_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/dense_vector.h"
+
+// C++ includes
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+template <typename T> class DenseMatrix;
+
+/**
+ * A batch of small square dense matrices, all of the same size, which
+ * are factored together.
+ *
+ * Factoring many tiny matrices one at a time spends most of its time
+ * in loop overhead.  Instead, the matrices of a batch are stored
+ * interleaved in groups of \p width: entry (i,j) of each matrix in a
+ * group is contiguous, so every step of the factorization runs over
+ * the whole group in its innermost loop, which the compiler can
+ * vectorize.  Unused slots in the last group are padded with
+ * identity matrices.
+ *
+ * The factorizations use the same algorithms as
+ * \p DenseMatrix::cholesky_solve() and \p DenseMatrix::lu_solve(),
+ * and once factored each system can be solved for any right hand
+ * side type that \p DenseMatrix supports.
+ */
+template <typename T>
+class DenseMatrixBatch
+{
+public:
+  /**
+   * Constructor.  Creates an empty batch of \p n by \p n matrices.
+   */
+  explicit
+  DenseMatrixBatch (const unsigned int n = 0);
+
+  /**
+   * The number of matrices stored interleaved in each group.
+   */
+  static const unsigned int width = 8;
+
+  /**
+   * Removes all matrices from the batch, and sets the size of the
+   * matrices which may be added to \p n by \p n.
+   */
+  void resize (const unsigned int n);
+
+  /**
+   * Removes all matrices from the batch, keeping their size and any
+   * allocated storage.
+   */
+  void clear ();
+
+  /**
+   * \returns The row and column dimension of the matrices.
+   */
+  unsigned int n () const { return _n; }
+
+  /**
+   * \returns The number of matrices in the batch.
+   */
+  std::size_t size () const { return _size; }
+
+  /**
+   * \returns \p true if there are no matrices in the batch.
+   */
+  bool empty () const { return !_size; }
+
+  /**
+   * Appends the matrix \p A, which must be \p n() by \p n(), to the
+   * batch.  Matrices cannot be added after the batch is factored.
+   *
+   * \returns The index of \p A in the batch.
+   */
+  std::size_t add_matrix (const DenseMatrix<T> & A);
+
+  /**
+   * Computes the Cholesky factorization of every matrix in the
+   * batch.  The matrices must be symmetric positive definite.
+   */
+  void cholesky_decompose ();
+
+  /**
+   * Computes the LU factorization, with partial pivoting, of every
+   * matrix in the batch.
+   */
+  void lu_decompose ();
+
+  /**
+   * Solves the \p k'th system, after \p cholesky_decompose(), for
+   * the right hand side \p b.
+   */
+  template <typename T2>
+  void cholesky_back_substitute (const std::size_t k,
+                                 const DenseVector<T2> & b,
+                                 DenseVector<T2> & x) const;
+
+  /**
+   * Solves the \p k'th system, after \p lu_decompose(), for the
+   * right hand side \p b.
+   */
+  template <typename T2>
+  void lu_back_substitute (const std::size_t k,
+                           const DenseVector<T2> & b,
+                           DenseVector<T2> & x) const;
+
+private:
+
+  /**
+   * \returns The offset of entry \p (i,j) of the \p k'th matrix.
+   */
+  std::size_t index (const std::size_t k,
+                     const unsigned int i,
+                     const unsigned int j) const
+  {
+    return ((k / width) * _n * _n + i * _n + j) * width + k % width;
+  }
+
+  /**
+   * \returns The \p (i,j) entry of the \p k'th factored matrix.
+   */
+  const T & factor (const std::size_t k,
+                    const unsigned int i,
+                    const unsigned int j) const
+  {
+    return _val[this->index(k, i, j)];
+  }
+
+  /**
+   * The factorizations we may have computed.
+   */
+  enum DecompositionType {LU, CHOLESKY, NONE};
+
+  unsigned int _n;
+
+  std::size_t _size;
+
+  DecompositionType _decomposition_type;
+
+  /**
+   * The interleaved matrix entries.
+   */
+  std::vector<T> _val;
+
+  /**
+   * The interleaved row interchanges of the LU factorizations.
+   */
+  std::vector<unsigned int> _pivots;
+};
+
+
+
+// ------------------------------------------------------------
+// DenseMatrixBatch member functions
+template <typename T>
+template <typename T2>
+inline
+void DenseMatrixBatch<T>::cholesky_back_substitute (const std::size_t k,
+                                                    const DenseVector<T2> & b,
+                                                    DenseVector<T2> & x) const
+{
+  libmesh_assert_equal_to (_decomposition_type, CHOLESKY);
+  libmesh_assert_less (k, _size);
+  libmesh_assert_equal_to (b.size(), _n);
+
+  x.resize(_n);
+
+  // Solve for Ly=b
+  for (unsigned int i=0; i<_n; ++i)
+    {
+      T2 temp = b(i);
+
+      for (unsigned int l=0; l<i; ++l)
+        temp -= this->factor(k,i,l)*x(l);
+
+      x(i) = temp / this->factor(k,i,i);
+    }
+
+  // Solve for L^T x = y
+  for (unsigned int i=0; i<_n; ++i)
+    {
+      const unsigned int ib = (_n-1)-i;
+
+      for (unsigned int l=(ib+1); l<_n; ++l)
+        x(ib) -= this->factor(k,l,ib) * x(l);
+
+      x(ib) /= this->factor(k,ib,ib);
+    }
+}
+
+
+
+template <typename T>
+template <typename T2>
+inline
+void DenseMatrixBatch<T>::lu_back_substitute (const std::size_t k,
+                                              const DenseVector<T2> & b,
+                                              DenseVector<T2> & x) const
+{
+  libmesh_assert_equal_to (_decomposition_type, LU);
+  libmesh_assert_less (k, _size);
+  libmesh_assert_equal_to (b.size(), _n);
+
+  x.resize(_n);
+
+  // Temporary vector storage.  We use this instead of
+  // modifying the RHS.
+  DenseVector<T2> z = b;
+
+  // Lower-triangular "top to bottom" solve step, taking into account pivots
+  for (unsigned int i=0; i<_n; ++i)
+    {
+      const unsigned int pivot = _pivots[((k / width) * _n + i) * width + k % width];
+      if (pivot != i)
+        std::swap( z(i), z(pivot) );
+
+      x(i) = z(i);
+
+      for (unsigned int j=0; j<i; ++j)
+        x(i) -= this->factor(k,i,j)*x(j);
+
+      x(i) /= this->factor(k,i,i);
+    }
+
+  // Upper-triangular "bottom to top" solve step
+  for (unsigned int ib=_n; ib != 0; --ib)
+    {
+      const unsigned int i = ib-1;
+      for (unsigned int j=i+1; j<_n; ++j)
+        x(i) -= this->factor(k,i,j)*x(j);
+    }
+}
+
+} // namespace libMesh
+
+#endif // LIBMESH_DENSE_MATRIX_BATCH_H
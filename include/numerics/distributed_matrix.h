@@ -0,0 +1,331 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_DISTRIBUTED_MATRIX_H
+#define LIBMESH_DISTRIBUTED_MATRIX_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/sparse_matrix.h"
+
+// C++ includes
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+template <typename T> class DenseMatrix;
+template <typename T> class DistributedVector;
+
+/**
+ * This class provides a simple parallel, distributed sparse matrix
+ * datatype which is specific to libmesh, for use with
+ * \p DistributedVector when no external solver package is available.
+ * All overridden virtual functions are documented in sparse_matrix.h.
+ *
+ * Each processor stores its rows in compressed row format, split like
+ * PETSc's MPIAIJ matrices into the block of columns matching its own
+ * vector entries and the block of all other columns.  Storage is
+ * preallocated from the per-row nonzero counts computed by the
+ * \p DofMap, and inserting more entries into a row than were
+ * preallocated is an error.
+ *
+ * Entries in rows owned by other processors are sent to their owners
+ * by \p close(), which also determines which vector entries each
+ * processor needs from its neighbors for a matrix-vector product.
+ * Products exchange only those entries, multiplying by the local
+ * block while the messages are in flight, and are threaded over rows.
+ */
+template <typename T>
+class DistributedMatrix final : public SparseMatrix<T>
+{
+public:
+  /**
+   * Constructor; initializes the matrix to be empty, without any
+   * structure.  You have to initialize the matrix before usage with
+   * \p init(...).
+   */
+  explicit
+  DistributedMatrix (const Parallel::Communicator & comm);
+
+  /**
+   * The 5 special functions can be defaulted for this class, as it
+   * does not manage any memory itself.
+   */
+  DistributedMatrix (DistributedMatrix &&) = default;
+  DistributedMatrix (const DistributedMatrix &) = default;
+  DistributedMatrix & operator= (const DistributedMatrix &) = default;
+  DistributedMatrix & operator= (DistributedMatrix &&) = default;
+  virtual ~DistributedMatrix () = default;
+
+  virtual void init (const numeric_index_type m,
+                     const numeric_index_type n,
+                     const numeric_index_type m_l,
+                     const numeric_index_type n_l,
+                     const numeric_index_type nnz=30,
+                     const numeric_index_type noz=10,
+                     const numeric_index_type blocksize=1) override;
+
+  virtual void init (ParallelType = PARALLEL) override;
+
+  virtual void clear () override;
+
+  virtual void zero () override;
+
+  virtual std::unique_ptr<SparseMatrix<T>> zero_clone () const override;
+
+  virtual std::unique_ptr<SparseMatrix<T>> clone () const override;
+
+  virtual void zero_rows (std::vector<numeric_index_type> & rows,
+                          T diag_value = 0.0) override;
+
+  virtual void close () override;
+
+  virtual numeric_index_type m () const override;
+
+  virtual numeric_index_type n () const override;
+
+  virtual numeric_index_type row_start () const override;
+
+  virtual numeric_index_type row_stop () const override;
+
+  virtual std::size_t memory_usage () const override;
+
+  virtual void set (const numeric_index_type i,
+                    const numeric_index_type j,
+                    const T value) override;
+
+  virtual void add (const numeric_index_type i,
+                    const numeric_index_type j,
+                    const T value) override;
+
+  virtual void add_matrix (const DenseMatrix<T> & dm,
+                           const std::vector<numeric_index_type> & rows,
+                           const std::vector<numeric_index_type> & cols) override;
+
+  virtual void add_matrix (const DenseMatrix<T> & dm,
+                           const std::vector<numeric_index_type> & dof_indices) override;
+
+  /**
+   * Compute A += a*X for scalar \p a, matrix \p X, which must have
+   * the same row and column partitioning as this matrix.
+   */
+  virtual void add (const T a, const SparseMatrix<T> & X) override;
+
+  /**
+   * \returns The \p (i,j) entry of the matrix, or zero if it isn't
+   * stored.  Row \p i must be local.
+   */
+  virtual T operator () (const numeric_index_type i,
+                         const numeric_index_type j) const override;
+
+  virtual Real l1_norm () const override;
+
+  virtual Real linfty_norm () const override;
+
+  virtual bool closed() const override { return _closed; }
+
+  virtual void print_personal(std::ostream & os=libMesh::out) const override { this->print(os); }
+
+  virtual void get_diagonal (NumericVector<T> & dest) const override;
+
+  virtual void get_transpose (SparseMatrix<T> & dest) const override;
+
+  virtual void get_row(numeric_index_type i,
+                       std::vector<numeric_index_type> & indices,
+                       std::vector<T> & values) const override;
+
+  /**
+   * \returns The size of the dense coupled blocks this matrix was
+   * initialized with, e.g. the number of variables in a system whose
+   * variables all have the same type.
+   */
+  numeric_index_type block_size () const { return _block_size; }
+
+  /**
+   * Adds the product of this matrix and \p arg to \p dest.  \p arg
+   * must be partitioned like the columns of the matrix, and \p dest
+   * like its rows.
+   */
+  void multiply_add (DistributedVector<T> & dest,
+                     const DistributedVector<T> & arg) const;
+
+private:
+
+  /**
+   * The rows of one block of the matrix in compressed row format.
+   * Each row has a fixed capacity, of which the first \p lengths
+   * entries are used, with sorted column indices.
+   */
+  struct CompressedRows
+  {
+    /**
+     * Allocates empty rows with the given capacities.
+     */
+    void init (const std::vector<numeric_index_type> & capacities);
+
+    /**
+     * \returns A pointer to entry \p (i,j), or \p nullptr if it isn't
+     * stored.
+     */
+    const T * find (const numeric_index_type i,
+                    const numeric_index_type j) const;
+
+    /**
+     * \returns A pointer to entry \p (i,j), which is created with
+     * value zero if necessary, or \p nullptr if row \p i is full.
+     * Sets \p created if a new entry was created.
+     */
+    T * insert (const numeric_index_type i,
+                const numeric_index_type j,
+                bool & created);
+
+    /**
+     * The start of each row's storage, plus the total storage at the
+     * end.
+     */
+    std::vector<numeric_index_type> offsets;
+
+    /**
+     * The number of entries used in each row.
+     */
+    std::vector<numeric_index_type> lengths;
+
+    std::vector<numeric_index_type> cols;
+
+    std::vector<T> vals;
+  };
+
+  /**
+   * Initializes the matrix with \p n_nz[i] entries preallocated in
+   * the local columns of local row \p i, and \p n_oz[i] in the others.
+   */
+  void init_rows (const numeric_index_type m,
+                  const numeric_index_type n,
+                  const numeric_index_type m_l,
+                  const numeric_index_type n_l,
+                  const std::vector<numeric_index_type> & n_nz,
+                  const std::vector<numeric_index_type> & n_oz,
+                  const numeric_index_type blocksize);
+
+  /**
+   * \returns A reference to entry \p (i,j) in a local row, which is
+   * created with value zero if necessary.
+   */
+  T & local_entry (const numeric_index_type i,
+                   const numeric_index_type j);
+
+  /**
+   * Determines which vector entries we need from other processors for
+   * products with the off-diagonal block, and which of our entries
+   * they need from us.
+   */
+  void init_ghosts ();
+
+  numeric_index_type _m;
+
+  numeric_index_type _n;
+
+  numeric_index_type _row_start;
+
+  numeric_index_type _row_stop;
+
+  numeric_index_type _col_start;
+
+  numeric_index_type _col_stop;
+
+  numeric_index_type _block_size;
+
+  /**
+   * The (last local row + 1) of each processor.
+   */
+  std::vector<numeric_index_type> _row_stops;
+
+  /**
+   * The (last local column + 1) of each processor.
+   */
+  std::vector<numeric_index_type> _col_stops;
+
+  /**
+   * The local rows restricted to the local columns, with column
+   * indices relative to \p _col_start.
+   */
+  CompressedRows _diagonal_block;
+
+  /**
+   * The local rows restricted to the nonlocal columns, with global
+   * column indices.
+   */
+  CompressedRows _off_diagonal_block;
+
+  /**
+   * The sorted global indices of the nonlocal columns with entries.
+   */
+  std::vector<numeric_index_type> _ghost_cols;
+
+  /**
+   * The index in \p _ghost_cols of each used entry of the
+   * off-diagonal block.
+   */
+  std::vector<numeric_index_type> _off_diagonal_ghosts;
+
+  /**
+   * The range of \p _ghost_cols owned by each processor we receive
+   * vector entries from.
+   */
+  std::map<processor_id_type,
+           std::pair<numeric_index_type, numeric_index_type>> _ghost_recv_ranges;
+
+  /**
+   * The local offsets of the vector entries needed by each processor
+   * we send vector entries to, in the order that processor stores
+   * them.
+   */
+  std::map<processor_id_type, std::vector<numeric_index_type>> _ghost_send_offsets;
+
+  /**
+   * The (row, column, is_set) triples of the entries set or added in
+   * each other processor's rows since the last \p close().
+   */
+  std::map<processor_id_type, std::vector<numeric_index_type>> _nonlocal_ids;
+
+  /**
+   * The values set or added in each other processor's rows since the
+   * last \p close().
+   */
+  std::map<processor_id_type, std::vector<T>> _nonlocal_values;
+
+  /**
+   * Whether entries have been created in the off-diagonal block since
+   * the last \p close().
+   */
+  bool _new_off_diagonal_entries;
+
+  /**
+   * Flag indicating if the matrix has been closed yet.
+   */
+  bool _closed;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_DISTRIBUTED_MATRIX_H
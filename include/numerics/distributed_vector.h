@@ -26,6 +26,7 @@
 
 // Local includes
 #include "libmesh/int_range.h"
+#include "libmesh/memory_usage.h"
 #include "libmesh/numeric_vector.h"
 #include "libmesh/parallel.h"
 
@@ -33,10 +34,15 @@
 #include <vector>
 #include <algorithm>
 #include <limits>
+#include <map>
+#include <utility>
 
 namespace libMesh
 {
 
+// Forward declarations
+template <typename T> class DistributedMatrix;
+
 /**
  * This class provides a simple parallel, distributed vector datatype
  * which is specific to libmesh. Offers some collective communication
@@ -46,6 +52,14 @@ namespace libMesh
  * processor. All overridden virtual functions are documented in
  * numeric_vector.h.
  *
+ * GHOSTED vectors also store copies of the nonlocal entries given at
+ * initialization, typically the \p DofMap send list.  The processors
+ * which own or ghost each entry are determined once, when the vector
+ * is initialized, so refreshing the ghost values in \p close() only
+ * exchanges messages between neighboring processors.  Only the local
+ * entries may be set, and operations other than \p close() and
+ * \p localize() leave the ghost values unchanged.
+ *
  * \author Benjamin S. Kirk
  * \date 2003
  */
@@ -157,6 +171,8 @@ public:
 
   virtual numeric_index_type local_size() const override;
 
+  virtual std::size_t memory_usage () const override;
+
   virtual numeric_index_type first_local_index() const override;
 
   virtual numeric_index_type last_local_index() const override;
@@ -191,9 +207,12 @@ public:
    */
   using NumericVector<T>::add_vector;
 
-  virtual void add_vector (const NumericVector<T> &,
-                           const SparseMatrix<T> &) override
-  { libmesh_not_implemented(); }
+  /**
+   * Computes \f$ \vec{u} \leftarrow \vec{u} + A \vec{v} \f$.  \p A
+   * must be a \p DistributedMatrix.
+   */
+  virtual void add_vector (const NumericVector<T> & v,
+                           const SparseMatrix<T> & A) override;
 
   virtual void add_vector_transpose (const NumericVector<T> &,
                                      const SparseMatrix<T> &) override
@@ -205,6 +224,13 @@ public:
 
   virtual T dot(const NumericVector<T> & V) const override;
 
+  /**
+   * \returns The dot product of the local entries of this vector and
+   * \p V, without summing over processors.  Solvers use this to
+   * combine the reductions for several dot products into one.
+   */
+  T local_dot (const NumericVector<T> & V) const;
+
   virtual void localize (std::vector<T> & v_local) const override;
 
   virtual void localize (NumericVector<T> & v_local) const override;
@@ -229,11 +255,48 @@ public:
 
 private:
 
+  /**
+   * Determines which processors own our ghost entries and which
+   * processors ghost our local entries, so that \p update_ghosts()
+   * can exchange values with those processors only.
+   */
+  void init_ghosts (const std::vector<numeric_index_type> & ghost);
+
+  /**
+   * Copies the current values of the ghost entries from the
+   * processors which own them.
+   */
+  void update_ghosts ();
+
   /**
    * Actual vector datatype to hold vector entries.
    */
   std::vector<T> _values;
 
+  /**
+   * The sorted global indices of the ghost entries.
+   */
+  std::vector<numeric_index_type> _ghost_indices;
+
+  /**
+   * The values of the ghost entries, in the order of
+   * \p _ghost_indices.
+   */
+  std::vector<T> _ghost_values;
+
+  /**
+   * The range of \p _ghost_values owned by each processor we receive
+   * ghost values from.
+   */
+  std::map<processor_id_type,
+           std::pair<numeric_index_type, numeric_index_type>> _ghost_recv_ranges;
+
+  /**
+   * The local offsets of the entries ghosted by each processor we
+   * send ghost values to, in the order that processor stores them.
+   */
+  std::map<processor_id_type, std::vector<numeric_index_type>> _ghost_send_offsets;
+
   /**
    * The global vector size.
    */
@@ -253,6 +316,11 @@ private:
    * The last component (+1) stored locally.
    */
   numeric_index_type _last_local_index;
+
+  /**
+   * Matrix-vector products work directly with our values.
+   */
+  friend class DistributedMatrix<T>;
 };
 
 
@@ -397,23 +465,46 @@ template <typename T>
 inline
 void DistributedVector<T>::init (const numeric_index_type n,
                                  const numeric_index_type n_local,
-                                 const std::vector<numeric_index_type> & /*ghost*/,
+                                 const std::vector<numeric_index_type> & ghost,
                                  const bool fast,
-                                 const ParallelType ptype)
+                                 const ParallelType libmesh_dbg_var(ptype))
 {
-  // TODO: we shouldn't ignore the ghost sparsity pattern
-  this->init(n, n_local, fast, ptype);
+  libmesh_assert(ptype == AUTOMATIC || ptype == GHOSTED);
+
+  this->init(n, n_local, true, PARALLEL);
+
+  this->_type = GHOSTED;
+
+  this->init_ghosts(ghost);
+
+  if (!fast)
+    this->zero();
 }
 
 
 
-/* Default implementation for solver packages for which ghosted
-   vectors are not yet implemented.  */
 template <class T>
 void DistributedVector<T>::init (const NumericVector<T> & other,
                                  const bool fast)
 {
-  this->init(other.size(),other.local_size(),fast,other.type());
+  if (other.type() == GHOSTED)
+    {
+      const DistributedVector<T> & v = cast_ref<const DistributedVector<T> &>(other);
+
+      this->init(v.size(), v.local_size(), true, PARALLEL);
+
+      // The same ghost entries need the same communication pattern
+      this->_type = GHOSTED;
+      _ghost_indices = v._ghost_indices;
+      _ghost_values.resize(_ghost_indices.size());
+      _ghost_recv_ranges = v._ghost_recv_ranges;
+      _ghost_send_offsets = v._ghost_send_offsets;
+
+      if (!fast)
+        this->zero();
+    }
+  else
+    this->init(other.size(),other.local_size(),fast,other.type());
 }
 
 
@@ -435,6 +526,9 @@ void DistributedVector<T>::close ()
 {
   libmesh_assert (this->initialized());
 
+  if (this->type() == GHOSTED)
+    this->update_ghosts();
+
   this->_is_closed = true;
 }
 
@@ -445,6 +539,10 @@ inline
 void DistributedVector<T>::clear ()
 {
   _values.clear();
+  _ghost_indices.clear();
+  _ghost_values.clear();
+  _ghost_recv_ranges.clear();
+  _ghost_send_offsets.clear();
 
   _global_size =
     _local_size =
@@ -468,6 +566,10 @@ void DistributedVector<T>::zero ()
   std::fill (_values.begin(),
              _values.end(),
              0.);
+
+  std::fill (_ghost_values.begin(),
+             _ghost_values.end(),
+             0.);
 }
 
 
@@ -521,6 +623,24 @@ numeric_index_type DistributedVector<T>::local_size () const
 
 
 
+template <typename T>
+inline
+std::size_t DistributedVector<T>::memory_usage () const
+{
+  std::size_t bytes = MemoryUsage::heap_bytes(_values) +
+    MemoryUsage::heap_bytes(_ghost_indices) +
+    MemoryUsage::heap_bytes(_ghost_values) +
+    MemoryUsage::heap_bytes(_ghost_recv_ranges) +
+    MemoryUsage::heap_bytes(_ghost_send_offsets);
+
+  for (const auto & pr : _ghost_send_offsets)
+    bytes += MemoryUsage::heap_bytes(pr.second);
+
+  return bytes;
+}
+
+
+
 template <typename T>
 inline
 numeric_index_type DistributedVector<T>::first_local_index () const
@@ -554,10 +674,17 @@ T DistributedVector<T>::operator() (const numeric_index_type i) const
   libmesh_assert (this->initialized());
   libmesh_assert_equal_to (_values.size(), _local_size);
   libmesh_assert_equal_to ((_last_local_index - _first_local_index), _local_size);
-  libmesh_assert ( ((i >= first_local_index()) &&
-                    (i <  last_local_index())) );
 
-  return _values[i - _first_local_index];
+  if ((i >= _first_local_index) && (i < _last_local_index))
+    return _values[i - _first_local_index];
+
+  // Otherwise this had better be one of our ghost entries
+  auto it = std::lower_bound(_ghost_indices.begin(),
+                             _ghost_indices.end(), i);
+
+  libmesh_assert (it != _ghost_indices.end() && *it == i);
+
+  return _ghost_values[std::distance(_ghost_indices.begin(), it)];
 }
 
 
@@ -641,6 +768,10 @@ void DistributedVector<T>::swap (NumericVector<T> & other)
 {
   DistributedVector<T> & v = cast_ref<DistributedVector<T> &>(other);
 
+  // Swap the flags and the parallel type too, since ghosted and
+  // unghosted vectors have different storage.
+  NumericVector<T>::swap(v);
+
   std::swap(_global_size, v._global_size);
   std::swap(_local_size, v._local_size);
   std::swap(_first_local_index, v._first_local_index);
@@ -648,6 +779,10 @@ void DistributedVector<T>::swap (NumericVector<T> & other)
 
   // This should be O(1) with any reasonable STL implementation
   std::swap(_values, v._values);
+  std::swap(_ghost_indices, v._ghost_indices);
+  std::swap(_ghost_values, v._ghost_values);
+  std::swap(_ghost_recv_ranges, v._ghost_recv_ranges);
+  std::swap(_ghost_send_offsets, v._ghost_send_offsets);
 }
 
 } // namespace libMesh
@@ -0,0 +1,488 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FIXED_DENSE_MATRIX_H
+#define LIBMESH_FIXED_DENSE_MATRIX_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/dense_matrix_base.h"
+#include "libmesh/fixed_dense_vector.h"
+
+// C++ includes
+#include <cmath>
+#include <utility>
+
+namespace libMesh
+{
+
+/**
+ * A dense matrix whose dimensions \p M by \p N are fixed at compile
+ * time, with its entries stored inline, in row-major order, rather
+ * than on the heap.  This lets element kernels of a known size
+ * (e.g. a Hex8 element with three variables, 24 by 24) work with
+ * stack-allocated matrices whose loops the compiler can unroll and
+ * vectorize.
+ *
+ * Element matrices of this type can be added to a \p SparseMatrix
+ * directly via \p SparseMatrix::add_matrix(), and constrained via
+ * \p DofMap::constrain_element_matrix(); since constraints may
+ * couple an element to dofs outside it, the latter copies the matrix
+ * into a resizable \p DenseMatrix only when some of its dofs are
+ * actually constrained.
+ *
+ * Unlike \p DenseMatrix, the solve methods here do not overwrite the
+ * matrix with its factorization; they factor a copy on the stack.
+ */
+template <typename T, unsigned int M, unsigned int N>
+class FixedDenseMatrix : public DenseMatrixBase<T>
+{
+  static_assert(M > 0 && N > 0, "FixedDenseMatrix must have at least one entry");
+
+public:
+
+  /**
+   * Constructor.  The matrix is initialized to zero.
+   */
+  FixedDenseMatrix () : DenseMatrixBase<T>(M, N) { this->zero(); }
+
+  /**
+   * The 5 special functions can be defaulted for this class, as it
+   * does not manage any memory itself.
+   */
+  FixedDenseMatrix (FixedDenseMatrix &&) = default;
+  FixedDenseMatrix (const FixedDenseMatrix &) = default;
+  FixedDenseMatrix & operator= (const FixedDenseMatrix &) = default;
+  FixedDenseMatrix & operator= (FixedDenseMatrix &&) = default;
+  virtual ~FixedDenseMatrix() = default;
+
+  virtual void zero() override
+  {
+    for (unsigned int i=0; i != M*N; ++i)
+      _val[i] = 0.;
+  }
+
+  /**
+   * \returns The \p (i,j) element of the matrix.
+   */
+  const T & operator() (const unsigned int i,
+                        const unsigned int j) const
+  {
+    libmesh_assert_less (i, M);
+    libmesh_assert_less (j, N);
+    return _val[i*N + j];
+  }
+
+  /**
+   * \returns The \p (i,j) element of the matrix as a writable reference.
+   */
+  T & operator() (const unsigned int i,
+                  const unsigned int j)
+  {
+    libmesh_assert_less (i, M);
+    libmesh_assert_less (j, N);
+    return _val[i*N + j];
+  }
+
+  virtual T el(const unsigned int i,
+               const unsigned int j) const override
+  { return (*this)(i,j); }
+
+  virtual T & el(const unsigned int i,
+                 const unsigned int j) override
+  { return (*this)(i,j); }
+
+  /**
+   * \returns A pointer to the contiguous, row-major entries of the
+   * matrix.
+   */
+  T * data() { return _val; }
+  const T * data() const { return _val; }
+
+  /**
+   * Performs the operation: (*this) <- M2 * (*this), for any M by M
+   * matrix \p M2.
+   */
+  virtual void left_multiply (const DenseMatrixBase<T> & M2) override;
+
+  /**
+   * Performs the operation: (*this) <- M2 * (*this), without any
+   * virtual function calls.
+   */
+  void left_multiply (const FixedDenseMatrix<T,M,M> & M2);
+
+  /**
+   * Performs the operation: (*this) <- (*this) * M3, for any N by N
+   * matrix \p M3.
+   */
+  virtual void right_multiply (const DenseMatrixBase<T> & M3) override;
+
+  /**
+   * Performs the operation: (*this) <- (*this) * M3, without any
+   * virtual function calls.
+   */
+  void right_multiply (const FixedDenseMatrix<T,N,N> & M3);
+
+  /**
+   * \returns The product of this matrix with \p B.
+   */
+  template <unsigned int P>
+  FixedDenseMatrix<T,M,P> operator * (const FixedDenseMatrix<T,N,P> & B) const;
+
+  /**
+   * Performs the matrix-vector multiplication,
+   * \p dest := (*this) * \p arg.
+   */
+  void vector_mult (FixedDenseVector<T,M> & dest,
+                    const FixedDenseVector<T,N> & arg) const;
+
+  /**
+   * Performs the matrix-vector multiplication,
+   * \p dest := (*this)^T * \p arg.
+   */
+  void vector_mult_transpose (FixedDenseVector<T,N> & dest,
+                              const FixedDenseVector<T,M> & arg) const;
+
+  /**
+   * Performs the scaled matrix-vector multiplication,
+   * \p dest += \p factor * (*this) * \p arg.
+   */
+  void vector_mult_add (FixedDenseVector<T,M> & dest,
+                        const T factor,
+                        const FixedDenseVector<T,N> & arg) const;
+
+  /**
+   * \returns The transpose of this matrix.
+   */
+  FixedDenseMatrix<T,N,M> transpose () const;
+
+  /**
+   * Multiplies every element in the matrix by \p factor.
+   */
+  FixedDenseMatrix & operator *= (const T factor)
+  {
+    for (unsigned int i=0; i != M*N; ++i)
+      _val[i] *= factor;
+    return *this;
+  }
+
+  /**
+   * Adds \p mat to this matrix.
+   */
+  FixedDenseMatrix & operator += (const FixedDenseMatrix & mat)
+  {
+    for (unsigned int i=0; i != M*N; ++i)
+      _val[i] += mat._val[i];
+    return *this;
+  }
+
+  /**
+   * Subtracts \p mat from this matrix.
+   */
+  FixedDenseMatrix & operator -= (const FixedDenseMatrix & mat)
+  {
+    for (unsigned int i=0; i != M*N; ++i)
+      _val[i] -= mat._val[i];
+    return *this;
+  }
+
+  /**
+   * Solves the system Ax=b, using an LU factorization with partial
+   * pivoting of a copy of this (square) matrix.
+   */
+  void lu_solve (const FixedDenseVector<T,N> & b,
+                 FixedDenseVector<T,N> & x) const;
+
+  /**
+   * Solves the system Ax=b, using a Cholesky factorization of a copy
+   * of this matrix, which must be symmetric positive definite.
+   */
+  void cholesky_solve (const FixedDenseVector<T,N> & b,
+                       FixedDenseVector<T,N> & x) const;
+
+private:
+
+  /**
+   * The actual data values, stored inline in row-major order.
+   */
+  T _val[M*N];
+};
+
+
+
+// ------------------------------------------------------------
+// FixedDenseMatrix member functions
+template <typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::left_multiply (const DenseMatrixBase<T> & M2)
+{
+  libmesh_assert_equal_to (M2.m(), M);
+  libmesh_assert_equal_to (M2.n(), M);
+
+  FixedDenseMatrix<T,M,M> A;
+  for (unsigned int i=0; i != M; ++i)
+    for (unsigned int j=0; j != M; ++j)
+      A(i,j) = M2.el(i,j);
+
+  this->left_multiply(A);
+}
+
+
+
+template <typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::left_multiply (const FixedDenseMatrix<T,M,M> & M2)
+{
+  *this = M2 * (*this);
+}
+
+
+
+template <typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::right_multiply (const DenseMatrixBase<T> & M3)
+{
+  libmesh_assert_equal_to (M3.m(), N);
+  libmesh_assert_equal_to (M3.n(), N);
+
+  FixedDenseMatrix<T,N,N> B;
+  for (unsigned int i=0; i != N; ++i)
+    for (unsigned int j=0; j != N; ++j)
+      B(i,j) = M3.el(i,j);
+
+  this->right_multiply(B);
+}
+
+
+
+template <typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::right_multiply (const FixedDenseMatrix<T,N,N> & M3)
+{
+  *this = (*this) * M3;
+}
+
+
+
+template <typename T, unsigned int M, unsigned int N>
+template <unsigned int P>
+inline
+FixedDenseMatrix<T,M,P>
+FixedDenseMatrix<T,M,N>::operator * (const FixedDenseMatrix<T,N,P> & B) const
+{
+  FixedDenseMatrix<T,M,P> product;
+
+  // i-k-j ordering, so the innermost loop runs along rows of both B
+  // and the product
+  for (unsigned int i=0; i != M; ++i)
+    for (unsigned int k=0; k != N; ++k)
+      {
+        const T a_ik = (*this)(i,k);
+        for (unsigned int j=0; j != P; ++j)
+          product(i,j) += a_ik * B(k,j);
+      }
+
+  return product;
+}
+
+
+
+template <typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::vector_mult (FixedDenseVector<T,M> & dest,
+                                           const FixedDenseVector<T,N> & arg) const
+{
+  dest.zero();
+  this->vector_mult_add(dest, 1., arg);
+}
+
+
+
+template <typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::vector_mult_transpose (FixedDenseVector<T,N> & dest,
+                                                     const FixedDenseVector<T,M> & arg) const
+{
+  dest.zero();
+  for (unsigned int i=0; i != M; ++i)
+    {
+      const T arg_i = arg(i);
+      for (unsigned int j=0; j != N; ++j)
+        dest(j) += (*this)(i,j) * arg_i;
+    }
+}
+
+
+
+template <typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::vector_mult_add (FixedDenseVector<T,M> & dest,
+                                               const T factor,
+                                               const FixedDenseVector<T,N> & arg) const
+{
+  for (unsigned int i=0; i != M; ++i)
+    {
+      T sum = 0.;
+      for (unsigned int j=0; j != N; ++j)
+        sum += (*this)(i,j) * arg(j);
+      dest(i) += factor * sum;
+    }
+}
+
+
+
+template <typename T, unsigned int M, unsigned int N>
+inline
+FixedDenseMatrix<T,N,M> FixedDenseMatrix<T,M,N>::transpose () const
+{
+  FixedDenseMatrix<T,N,M> AT;
+  for (unsigned int i=0; i != M; ++i)
+    for (unsigned int j=0; j != N; ++j)
+      AT(j,i) = (*this)(i,j);
+  return AT;
+}
+
+
+
+template <typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::lu_solve (const FixedDenseVector<T,N> & b,
+                                        FixedDenseVector<T,N> & x) const
+{
+  static_assert(M == N, "lu_solve requires a square matrix");
+
+  // Factor a copy, the same way DenseMatrix::_lu_decompose() does
+  FixedDenseMatrix<T,N,N> A = *this;
+  unsigned int pivots[N];
+
+  for (unsigned int i=0; i != N; ++i)
+    {
+      // Find the pivot row by searching down the i'th column
+      pivots[i] = i;
+
+      auto the_max = std::abs( A(i,i) );
+      for (unsigned int j=i+1; j != N; ++j)
+        {
+          auto candidate_max = std::abs( A(j,i) );
+          if (the_max < candidate_max)
+            {
+              the_max = candidate_max;
+              pivots[i] = j;
+            }
+        }
+
+      if (pivots[i] != i)
+        for (unsigned int j=0; j != N; ++j)
+          std::swap( A(i,j), A(pivots[i], j) );
+
+      if (A(i,i) == T(0))
+        libmesh_error_msg("Matrix A is singular!");
+
+      const T diag_inv = 1. / A(i,i);
+      for (unsigned int j=i+1; j != N; ++j)
+        A(i,j) *= diag_inv;
+
+      for (unsigned int row=i+1; row != N; ++row)
+        for (unsigned int col=i+1; col != N; ++col)
+          A(row,col) -= A(row,i) * A(i,col);
+    }
+
+  // Lower-triangular "top to bottom" solve step, taking into account
+  // pivots
+  FixedDenseVector<T,N> z = b;
+
+  for (unsigned int i=0; i != N; ++i)
+    {
+      if (pivots[i] != i)
+        std::swap( z(i), z(pivots[i]) );
+
+      x(i) = z(i);
+
+      for (unsigned int j=0; j != i; ++j)
+        x(i) -= A(i,j)*x(j);
+
+      x(i) /= A(i,i);
+    }
+
+  // Upper-triangular "bottom to top" solve step
+  for (unsigned int ib=N; ib != 0; --ib)
+    {
+      const unsigned int i = ib-1;
+      for (unsigned int j=i+1; j != N; ++j)
+        x(i) -= A(i,j)*x(j);
+    }
+}
+
+
+
+template <typename T, unsigned int M, unsigned int N>
+inline
+void FixedDenseMatrix<T,M,N>::cholesky_solve (const FixedDenseVector<T,N> & b,
+                                              FixedDenseVector<T,N> & x) const
+{
+  static_assert(M == N, "cholesky_solve requires a square matrix");
+
+  // Factor a copy, the same way DenseMatrix::_cholesky_decompose() does
+  FixedDenseMatrix<T,N,N> A = *this;
+
+  for (unsigned int i=0; i != N; ++i)
+    for (unsigned int j=i; j != N; ++j)
+      {
+        for (unsigned int k=0; k != i; ++k)
+          A(i,j) -= A(i,k) * A(j,k);
+
+        if (i == j)
+          {
+#ifndef LIBMESH_USE_COMPLEX_NUMBERS
+            if (A(i,j) <= 0.0)
+              libmesh_error_msg("Error! Can only use Cholesky decomposition with symmetric positive definite matrices.");
+#endif
+
+            A(i,i) = std::sqrt(A(i,j));
+          }
+        else
+          A(j,i) = A(i,j) / A(i,i);
+      }
+
+  // Solve for Ly=b
+  for (unsigned int i=0; i != N; ++i)
+    {
+      T temp = b(i);
+
+      for (unsigned int k=0; k != i; ++k)
+        temp -= A(i,k)*x(k);
+
+      x(i) = temp / A(i,i);
+    }
+
+  // Solve for L^T x = y
+  for (unsigned int ib=N; ib != 0; --ib)
+    {
+      const unsigned int i = ib-1;
+
+      for (unsigned int k=i+1; k != N; ++k)
+        x(i) -= A(k,i) * x(k);
+
+      x(i) /= A(i,i);
+    }
+}
+
+} // namespace libMesh
+
+#endif // LIBMESH_FIXED_DENSE_MATRIX_H
@@ -0,0 +1,184 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FIXED_DENSE_VECTOR_H
+#define LIBMESH_FIXED_DENSE_VECTOR_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/dense_vector_base.h"
+#include "libmesh/compare_types.h"
+#include "libmesh/tensor_tools.h"
+
+// C++ includes
+#include <cmath>
+
+namespace libMesh
+{
+
+/**
+ * A dense vector whose size \p N is fixed at compile time, with its
+ * entries stored inline rather than on the heap.  This lets element
+ * kernels of a known size (e.g. a Hex8 element with three variables,
+ * N = 24) work with stack-allocated vectors whose loops the compiler
+ * can unroll and vectorize.
+ *
+ * The entries can be added to a \p NumericVector directly via
+ * \p NumericVector::add_vector().
+ */
+template <typename T, unsigned int N>
+class FixedDenseVector : public DenseVectorBase<T>
+{
+  static_assert(N > 0, "FixedDenseVector must have at least one entry");
+
+public:
+
+  /**
+   * Constructor.  The vector is initialized to zero.
+   */
+  FixedDenseVector () { this->zero(); }
+
+  /**
+   * The 5 special functions can be defaulted for this class, as it
+   * does not manage any memory itself.
+   */
+  FixedDenseVector (FixedDenseVector &&) = default;
+  FixedDenseVector (const FixedDenseVector &) = default;
+  FixedDenseVector & operator= (const FixedDenseVector &) = default;
+  FixedDenseVector & operator= (FixedDenseVector &&) = default;
+  virtual ~FixedDenseVector() = default;
+
+  virtual unsigned int size() const override { return N; }
+
+  virtual bool empty() const override { return false; }
+
+  virtual void zero() override
+  {
+    for (unsigned int i=0; i != N; ++i)
+      _val[i] = 0.;
+  }
+
+  /**
+   * \returns Entry \p i of the vector as a const reference.
+   */
+  const T & operator() (const unsigned int i) const
+  {
+    libmesh_assert_less (i, N);
+    return _val[i];
+  }
+
+  /**
+   * \returns Entry \p i of the vector as a writable reference.
+   */
+  T & operator() (const unsigned int i)
+  {
+    libmesh_assert_less (i, N);
+    return _val[i];
+  }
+
+  virtual T el(const unsigned int i) const override
+  { return (*this)(i); }
+
+  virtual T & el(const unsigned int i) override
+  { return (*this)(i); }
+
+  /**
+   * \returns A pointer to the contiguous entries of the vector.
+   */
+  T * data() { return _val; }
+  const T * data() const { return _val; }
+
+  /**
+   * Multiplies every entry in the vector by \p factor.
+   */
+  FixedDenseVector & operator *= (const T factor)
+  {
+    for (unsigned int i=0; i != N; ++i)
+      _val[i] *= factor;
+    return *this;
+  }
+
+  /**
+   * Adds \p vec to this vector.
+   */
+  FixedDenseVector & operator += (const FixedDenseVector & vec)
+  {
+    for (unsigned int i=0; i != N; ++i)
+      _val[i] += vec._val[i];
+    return *this;
+  }
+
+  /**
+   * Subtracts \p vec from this vector.
+   */
+  FixedDenseVector & operator -= (const FixedDenseVector & vec)
+  {
+    for (unsigned int i=0; i != N; ++i)
+      _val[i] -= vec._val[i];
+    return *this;
+  }
+
+  /**
+   * Adds \p factor times \p vec to this vector.
+   */
+  template <typename T2>
+  typename boostcopy::enable_if_c<
+    ScalarTraits<T2>::value, void >::type
+  add (const T2 factor,
+       const FixedDenseVector & vec)
+  {
+    for (unsigned int i=0; i != N; ++i)
+      _val[i] += factor * vec._val[i];
+  }
+
+  /**
+   * \returns The dot product of this vector with \p vec, taking the
+   * complex conjugate of \p vec, as \p DenseVector::dot() does.
+   */
+  T dot (const FixedDenseVector & vec) const
+  {
+    T sum = 0.;
+    for (unsigned int i=0; i != N; ++i)
+      sum += _val[i] * libmesh_conj(vec._val[i]);
+    return sum;
+  }
+
+  /**
+   * \returns The \f$l_2\f$-norm of the vector, i.e. the square root
+   * of the sum of the squares of the entries.
+   */
+  Real l2_norm () const
+  {
+    Real norm = 0.;
+    for (unsigned int i=0; i != N; ++i)
+      norm += TensorTools::norm_sq(_val[i]);
+    return std::sqrt(norm);
+  }
+
+private:
+
+  /**
+   * The actual data values, stored inline.
+   */
+  T _val[N];
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FIXED_DENSE_VECTOR_H
@@ -0,0 +1,124 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_NATIVE_PRECONDITIONER_H
+#define LIBMESH_NATIVE_PRECONDITIONER_H
+
+// Local includes
+#include "libmesh/preconditioner.h"
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This class provides preconditioners implemented by libMesh itself,
+ * for use with \p NativeLinearSolver.  They are built from the local
+ * rows of any \p SparseMatrix, via \p get_row(), so they need no
+ * communication to set up or apply.  All overridden virtual functions
+ * are documented in preconditioner.h.
+ *
+ * The supported types are
+ * - \p IDENTITY_PRECOND
+ * - \p JACOBI_PRECOND: the inverse of the diagonal.
+ * - \p BLOCK_JACOBI_PRECOND: the inverses of the dense diagonal
+ *   blocks coupling the variables at each node, whose size is the
+ *   \p DistributedMatrix block size.  Matrices of other types use
+ *   blocks of size 1.
+ * - \p ILU_PRECOND: ILU(0) of each processor's diagonal block, i.e.
+ *   block Jacobi over processors with incomplete LU subdomain solves.
+ *
+ * Other types fall back to \p ILU_PRECOND.
+ */
+template <typename T>
+class NativePreconditioner : public Preconditioner<T>
+{
+public:
+
+  /**
+   * Constructor.
+   */
+  NativePreconditioner (const libMesh::Parallel::Communicator & comm_in);
+
+  virtual void apply(const NumericVector<T> & x, NumericVector<T> & y) override;
+
+  virtual void clear () override;
+
+  virtual void init () override;
+
+private:
+
+  /**
+   * Stores the inverse of the diagonal of the matrix.
+   */
+  void init_jacobi ();
+
+  /**
+   * Stores the inverses of the diagonal blocks of size \p block_size.
+   */
+  void init_block_jacobi (const numeric_index_type block_size);
+
+  /**
+   * Stores the ILU(0) factorization of the local diagonal block.
+   */
+  void init_ilu ();
+
+  /**
+   * Overwrites \p values with the solution of LUx = values, for the
+   * factors stored by \p init_ilu().
+   */
+  void ilu_solve (std::vector<T> & values) const;
+
+  /**
+   * The global indices of the local rows.
+   */
+  std::vector<numeric_index_type> _local_indices;
+
+  /**
+   * The size of the blocks of the block Jacobi preconditioner.
+   */
+  numeric_index_type _block_size;
+
+  /**
+   * The inverted diagonal blocks for block Jacobi, stored row by row,
+   * or the inverted diagonal for Jacobi.
+   */
+  std::vector<T> _block_inverses;
+
+  /**
+   * The ILU(0) factors of the local diagonal block in compressed row
+   * format, with sorted local column indices.  The unit diagonal of L
+   * is not stored.
+   */
+  std::vector<numeric_index_type> _ilu_offsets;
+  std::vector<numeric_index_type> _ilu_cols;
+  std::vector<T> _ilu_vals;
+
+  /**
+   * The position of the diagonal entry of each row in \p _ilu_cols.
+   */
+  std::vector<numeric_index_type> _ilu_diagonal;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_NATIVE_PRECONDITIONER_H
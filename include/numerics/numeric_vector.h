@@ -54,6 +54,7 @@ namespace libMesh
 template <typename T> class NumericVector;
 template <typename T> class DenseVector;
 template <typename T> class DenseSubVector;
+template <typename T, unsigned int N> class FixedDenseVector;
 template <typename T> class SparseMatrix;
 template <typename T> class ShellMatrix;
 
@@ -325,6 +326,14 @@ public:
    */
   virtual numeric_index_type local_size() const = 0;
 
+  /**
+   * \returns An estimate of the memory, in bytes, used by the entries
+   * of this vector stored on this processor, or zero if the vector is
+   * not initialized.  The base class counts the local entries only;
+   * derived classes add any ghost entries and bookkeeping.
+   */
+  virtual std::size_t memory_usage () const;
+
   /**
    * \returns The index of the first vector element actually stored on
    * this processor.
@@ -496,6 +505,19 @@ public:
   void add_vector (const DenseVector<T> & v,
                    const std::vector<numeric_index_type> & dof_indices);
 
+  /**
+   * Computes \f$ \vec{u} \leftarrow \vec{u} + \vec{v} \f$,
+   * where \p v is a FixedDenseVector and each \p dof_indices[i]
+   * specifies where to add value \p v(i).
+   */
+  template <unsigned int N>
+  void add_vector (const FixedDenseVector<T,N> & v,
+                   const std::vector<numeric_index_type> & dof_indices)
+  {
+    libmesh_assert_equal_to (dof_indices.size(), N);
+    this->add_vector (v.data(), dof_indices);
+  }
+
   /**
    * Computes \f$ \vec{u} \leftarrow \vec{u} + A \vec{v} \f$,
    * i.e. adds the product of a \p SparseMatrix \p A and a \p
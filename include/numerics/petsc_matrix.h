@@ -183,6 +183,8 @@ public:
 
   numeric_index_type local_m () const final;
 
+  virtual std::size_t memory_usage () const override;
+
   virtual numeric_index_type n () const override;
 
   /**
@@ -216,6 +218,10 @@ public:
   virtual void add_matrix (const DenseMatrix<T> & dm,
                            const std::vector<numeric_index_type> & dof_indices) override;
 
+  virtual void add_matrix_values (const T * values,
+                                  const std::vector<numeric_index_type> & rows,
+                                  const std::vector<numeric_index_type> & cols) override;
+
   virtual void add_block_matrix (const DenseMatrix<T> & dm,
                                  const std::vector<numeric_index_type> & brows,
                                  const std::vector<numeric_index_type> & bcols) override;
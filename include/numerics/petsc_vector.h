@@ -30,6 +30,7 @@
 #include "libmesh/numeric_vector.h"
 #include "libmesh/petsc_macro.h"
 #include "libmesh/int_range.h"
+#include "libmesh/memory_usage.h"
 #include "libmesh/libmesh_common.h"
 #include "libmesh/petsc_solver_exception.h"
 #include "libmesh/parallel_only.h"
@@ -185,6 +186,8 @@ public:
 
   virtual numeric_index_type local_size() const override;
 
+  virtual std::size_t memory_usage () const override;
+
   virtual numeric_index_type first_local_index() const override;
 
   virtual numeric_index_type last_local_index() const override;
@@ -954,6 +957,21 @@ numeric_index_type PetscVector<T>::local_size () const
 
 
 
+template <typename T>
+inline
+std::size_t PetscVector<T>::memory_usage () const
+{
+  if (!this->initialized())
+    return 0;
+
+  // Ghosted vectors store their ghost entries after the local ones
+  return NumericVector<T>::memory_usage() +
+    sizeof(T) * _global_to_local_map.size() +
+    MemoryUsage::heap_bytes(_global_to_local_map);
+}
+
+
+
 template <typename T>
 inline
 numeric_index_type PetscVector<T>::first_local_index () const
@@ -41,6 +41,7 @@ namespace libMesh
 // forward declarations
 template <typename T> class SparseMatrix;
 template <typename T> class DenseMatrix;
+template <typename T, unsigned int M, unsigned int N> class FixedDenseMatrix;
 class DofMap;
 namespace SparsityPattern { class Graph; }
 template <typename T> class NumericVector;
@@ -207,6 +208,15 @@ public:
    */
   virtual numeric_index_type local_m () const { return row_stop() - row_start(); }
 
+  /**
+   * \returns An estimate of the memory, in bytes, used by the rows of
+   * this matrix stored on this processor, or zero if it is not
+   * initialized.  The base class estimates compressed row storage of
+   * the sparsity computed by the attached \p DofMap; derived classes
+   * which know their actual storage report that instead.
+   */
+  virtual std::size_t memory_usage () const;
+
   /**
    * \returns The column-dimension of the matrix.
    */
@@ -257,6 +267,38 @@ public:
   virtual void add_matrix (const DenseMatrix<T> & dm,
                            const std::vector<numeric_index_type> & dof_indices) = 0;
 
+  /**
+   * Add the \p rows.size() by \p cols.size() block of values stored
+   * contiguously, in row-major order, starting at \p values.  The
+   * default implementation adds each entry separately; derived
+   * classes may override it to add the whole block at once.
+   */
+  virtual void add_matrix_values (const T * values,
+                                  const std::vector<numeric_index_type> & rows,
+                                  const std::vector<numeric_index_type> & cols);
+
+  /**
+   * Add the fixed-size matrix \p dm to the SparseMatrix.  This is
+   * useful for adding an element matrix at assembly time.
+   */
+  template <unsigned int M, unsigned int N>
+  void add_matrix (const FixedDenseMatrix<T,M,N> & dm,
+                   const std::vector<numeric_index_type> & rows,
+                   const std::vector<numeric_index_type> & cols)
+  {
+    libmesh_assert_equal_to (rows.size(), M);
+    libmesh_assert_equal_to (cols.size(), N);
+    this->add_matrix_values (dm.data(), rows, cols);
+  }
+
+  /**
+   * Same as above, but assumes the row and column maps are the same.
+   */
+  template <unsigned int N>
+  void add_matrix (const FixedDenseMatrix<T,N,N> & dm,
+                   const std::vector<numeric_index_type> & dof_indices)
+  { this->add_matrix (dm, dof_indices, dof_indices); }
+
   /**
    * Add the full matrix \p dm to the SparseMatrix.  This is useful
    * for adding an element matrix at assembly time.  The matrix is
@@ -168,6 +168,19 @@ public:
     _grainsize(r._grainsize)
   {}
 
+  /**
+   * Constructor.  Takes the grain size of \p r and the
+   * subrange [first,last), as needed by the pthreads
+   * implementation to give each thread its own range.
+   */
+  BlockedRange (const BlockedRange<T> & r,
+                const const_iterator first,
+                const const_iterator last) :
+    _grainsize(r._grainsize)
+  {
+    this->reset(first, last);
+  }
+
   /**
    * Splits the range \p r.  The first half
    * of the range is left in place, the second
@@ -220,7 +233,7 @@ public:
   /**
    * \returns The size of the range.
    */
-  int size () const { return (_end -_begin); }
+  std::size_t size () const { return (_end -_begin); }
 
   //------------------------------------------------------------------------
   // Methods that implement Range concept
@@ -0,0 +1,166 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_DIFFUSION_PARTITIONER_H
+#define LIBMESH_DIFFUSION_PARTITIONER_H
+
+// Local Includes
+#include "libmesh/multilevel_partitioner.h"
+
+// C++ Includes
+#include <map>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * The \p DiffusionPartitioner rebalances an existing partitioning
+ * incrementally, which suits meshes whose load changes a little at a
+ * time, as under adaptive refinement.  Rather than partitioning from
+ * scratch it moves elements only across the boundaries between
+ * neighboring processors, and only as much weight as is needed.
+ *
+ * The cost of an element is its attached weight, if any, and
+ * otherwise its number of nodes, the measure summed by
+ * \p MeshTools::weight().  If the heaviest processor is within the
+ * imbalance tolerance of the average, nothing moves at all.
+ * Otherwise the weight each processor should send to each neighbor
+ * is found from the diffusion solution of Hu and Blake, which
+ * minimizes the Euclidean norm of the flow, by solving a Laplace
+ * problem on the graph of neighboring processors.  Each processor
+ * then sends its elements, best cut first, growing inward from the
+ * boundary with each neighbor.
+ *
+ * Diffusion needs one part per processor, each with some elements.
+ * Otherwise, as for an initial partitioning, the mesh is partitioned
+ * from scratch by the parent \p MultilevelPartitioner.
+ *
+ * \brief Incremental, diffusion-based load balancing partitioner.
+ */
+class DiffusionPartitioner : public MultilevelPartitioner
+{
+public:
+
+  /**
+   * Constructor.
+   */
+  DiffusionPartitioner () :
+    _n_migrated_elem(0),
+    _migrated_weight(0)
+  {}
+
+  /**
+   * Copy/move ctor, copy/move assignment operator, and destructor are
+   * all explicitly defaulted for this class.
+   */
+  DiffusionPartitioner (const DiffusionPartitioner &) = default;
+  DiffusionPartitioner (DiffusionPartitioner &&) = default;
+  DiffusionPartitioner & operator= (const DiffusionPartitioner &) = default;
+  DiffusionPartitioner & operator= (DiffusionPartitioner &&) = default;
+  virtual ~DiffusionPartitioner() = default;
+
+  /**
+   * \returns A copy of this partitioner wrapped in a smart pointer.
+   */
+  virtual std::unique_ptr<Partitioner> clone () const override
+  {
+    return libmesh_make_unique<DiffusionPartitioner>(*this);
+  }
+
+  /**
+   * \returns The number of active elements which the last
+   * partitioning moved to a different processor.
+   */
+  dof_id_type n_migrated_elem () const { return _n_migrated_elem; }
+
+  /**
+   * \returns The total cost of the active elements which the last
+   * partitioning moved to a different processor.
+   */
+  dof_id_type migrated_weight () const { return _migrated_weight; }
+
+protected:
+
+  /**
+   * Rebalance the current partitioning of the \p MeshBase into \p n
+   * subdomains, or partition it from scratch if it has none.
+   */
+  virtual void _do_partition (MeshBase & mesh,
+                              const unsigned int n) override
+  { this->rebalance(mesh, n, false); }
+
+  /**
+   * Same as \p _do_partition(), which already moves as few elements
+   * as it can, except that a partitioning from scratch also
+   * minimizes migration.
+   */
+  virtual void _do_repartition (MeshBase & mesh,
+                                const unsigned int n) override
+  { this->rebalance(mesh, n, true); }
+
+private:
+
+  /**
+   * Does the work for both partitioning and repartitioning, falling
+   * back on the parent's \p _do_repartition() if \p repartition is
+   * set and on its \p _do_partition() otherwise.
+   */
+  void rebalance (MeshBase & mesh,
+                  const unsigned int n,
+                  const bool repartition);
+
+  /**
+   * Moves elements between neighboring processors to balance the
+   * load.
+   *
+   * \returns \p false if the current partitioning can't be diffused,
+   * in which case nothing was changed.
+   */
+  bool diffuse (MeshBase & mesh,
+                const unsigned int n);
+
+  /**
+   * Solves for the diffusion potentials of the processors, given the
+   * \p neighbors of each processor, weighted by the number of dual
+   * graph edges they share, and the \p loads.  The weight processor p
+   * should send to neighbor q is the edge weight times the difference
+   * in their potentials.
+   *
+   * \returns \p false if the processor graph isn't connected.
+   */
+  static bool compute_potentials (const std::vector<std::map<processor_id_type, dof_id_type>> & neighbors,
+                                  const std::vector<dof_id_type> & loads,
+                                  std::vector<Real> & potentials);
+
+  /**
+   * The cost of an element for load balancing.
+   */
+  dof_id_type elem_weight (const Elem & elem) const;
+
+  /**
+   * Migration statistics for the last partitioning.
+   */
+  dof_id_type _n_migrated_elem;
+  dof_id_type _migrated_weight;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_DIFFUSION_PARTITIONER_H
@@ -0,0 +1,173 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_ELEM_COST_MODEL_H
+#define LIBMESH_ELEM_COST_MODEL_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+
+// C++ Includes
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class Elem;
+class ErrorVector;
+class MeshBase;
+
+/**
+ * The \p ElemCostModel estimates how expensive each element is to
+ * work on, so that partitioners which accept weights (see
+ * \p Partitioner::attach_weights()) can balance the actual work
+ * rather than the number of elements.
+ *
+ * Without measurements, the cost of an element is modeled as its
+ * number of nodes, times (p+1)^dim for its p-refinement level p,
+ * times a factor for its subdomain which defaults to 1.
+ *
+ * The model is calibrated by adding timing samples, e.g. by setting
+ * \p FEMSystem::elem_cost_model, which times the assembly of every
+ * element.  Elements with the same subdomain, type and p-level as
+ * some sampled elements then cost their mean measured time, and the
+ * modeled cost of any others is scaled to match the measured time of
+ * all sampled elements.
+ *
+ * \brief Per-element cost estimates for weighted partitioning.
+ */
+class ElemCostModel
+{
+public:
+
+  /**
+   * Constructor.
+   */
+  ElemCostModel () = default;
+
+  /**
+   * Sets the factor by which the modeled cost of elements on
+   * subdomain \p sbd_id is scaled, e.g. to account for more expensive
+   * physics there.
+   */
+  void set_subdomain_factor (const subdomain_id_type sbd_id,
+                             const Real factor);
+
+  /**
+   * \returns The modeled cost of \p elem, ignoring any timing samples.
+   */
+  Real model_cost (const Elem & elem) const;
+
+  /**
+   * \returns The estimated cost of \p elem, in seconds if any timing
+   * samples have been added on this processor, or in the units of
+   * \p model_cost() otherwise.
+   */
+  Real cost (const Elem & elem) const;
+
+  /**
+   * Records that working on \p elem took \p seconds.
+   */
+  void add_sample (const Elem & elem,
+                   const Real seconds);
+
+  /**
+   * Records a batch of timing samples.  This may be called from
+   * several threads at once.
+   */
+  void add_samples (const std::vector<std::pair<const Elem *, Real>> & samples);
+
+  /**
+   * Forgets all timing samples, e.g. when the work per element
+   * changes.
+   */
+  void clear_samples ();
+
+  /**
+   * \returns The number of timing samples added on this processor.
+   */
+  dof_id_type n_samples () const;
+
+  /**
+   * Combines the timing samples from every processor and fills
+   * \p weights, indexed by element id, with the estimated cost of
+   * each active element on this processor, including ghosts.  The
+   * weights are normalized so that the cheapest active element costs
+   * 10, which leaves partitioners that truncate the weights to
+   * integers some resolution.
+   *
+   * This function must be run on all processors at once.
+   */
+  void build_weights (const MeshBase & mesh,
+                      ErrorVector & weights) const;
+
+private:
+
+  /**
+   * Elements are sampled by subdomain, type and p-level.
+   */
+  typedef std::tuple<subdomain_id_type, int, unsigned int> SampleKey;
+
+  static SampleKey sample_key (const Elem & elem);
+
+  /**
+   * The total measured time and modeled cost of the samples of one
+   * kind of element.
+   */
+  struct SampleData
+  {
+    Real time = 0;
+    Real model_cost = 0;
+    dof_id_type count = 0;
+  };
+
+  typedef std::map<SampleKey, SampleData> SampleMap;
+
+  /**
+   * \returns The estimated cost of \p elem given \p samples.
+   */
+  Real cost (const Elem & elem,
+             const SampleMap & samples,
+             const Real seconds_per_model_cost) const;
+
+  /**
+   * \returns The ratio of measured time to modeled cost over all
+   * \p samples, or 0 if there are none.
+   */
+  static Real seconds_per_model_cost (const SampleMap & samples);
+
+  /**
+   * The cost factor of each subdomain, where it isn't 1.
+   */
+  std::map<subdomain_id_type, Real> _subdomain_factors;
+
+  /**
+   * The timing samples added on this processor.
+   */
+  SampleMap _samples;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_ELEM_COST_MODEL_H
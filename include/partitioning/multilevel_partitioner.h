@@ -0,0 +1,150 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_MULTILEVEL_PARTITIONER_H
+#define LIBMESH_MULTILEVEL_PARTITIONER_H
+
+// Local Includes
+#include "libmesh/partitioner.h"
+#include "libmesh/auto_ptr.h" // libmesh_make_unique
+
+// C++ Includes
+#include <cstdint>
+
+namespace libMesh
+{
+
+/**
+ * The \p MultilevelPartitioner is a parallel multilevel k-way graph
+ * partitioner implemented by libMesh itself, so it needs neither
+ * METIS nor ParMETIS and never serializes the mesh.  It works on the
+ * dual graph from \p Partitioner::build_graph():
+ *
+ * - The graph is coarsened by heavy-edge matching of the vertices on
+ *   each processor, until it is small compared to the number of parts
+ *   or stops shrinking.
+ * - The coarsest graph, which is small, is gathered to every
+ *   processor and split by recursive bisection, with greedy graph
+ *   growing followed by Fiduccia-Mattheyses refinement.
+ * - The partitioning is projected back through the levels, and
+ *   improved on each one by parallel greedy boundary refinement.
+ *
+ * Elements are weighted by the attached weights, if any, and by
+ * their number of nodes otherwise.
+ *
+ * Since only vertices on the same processor are matched, coarse
+ * vertices never straddle the current partitioning.  On
+ * repartitioning, the initial partition is relabeled to overlap the
+ * current partitioning as much as possible, and refinement prefers to
+ * leave elements where they are, which keeps data migration small.
+ *
+ * \brief Native parallel multilevel graph partitioner.
+ */
+class MultilevelPartitioner : public Partitioner
+{
+public:
+
+  /**
+   * Signed type for differences of graph weights, such as the
+   * change in edge cut from moving a vertex.
+   */
+  typedef std::int64_t Gain;
+
+  /**
+   * Constructor.
+   */
+  MultilevelPartitioner () :
+    _imbalance_tolerance(1.05),
+    _edge_cut(0)
+  {}
+
+  /**
+   * Copy/move ctor, copy/move assignment operator, and destructor are
+   * all explicitly defaulted for this class.
+   */
+  MultilevelPartitioner (const MultilevelPartitioner &) = default;
+  MultilevelPartitioner (MultilevelPartitioner &&) = default;
+  MultilevelPartitioner & operator= (const MultilevelPartitioner &) = default;
+  MultilevelPartitioner & operator= (MultilevelPartitioner &&) = default;
+  virtual ~MultilevelPartitioner() = default;
+
+  /**
+   * \returns A copy of this partitioner wrapped in a smart pointer.
+   */
+  virtual std::unique_ptr<Partitioner> clone () const override
+  {
+    return libmesh_make_unique<MultilevelPartitioner>(*this);
+  }
+
+  virtual void attach_weights(ErrorVector * weights) override { _weights = weights; }
+
+  /**
+   * Sets the largest allowed ratio of a part's weight to the average
+   * part weight.  Defaults to 1.05.
+   */
+  void set_imbalance_tolerance (const Real tol)
+  {
+    libmesh_assert_greater_equal (tol, 1);
+    _imbalance_tolerance = tol;
+  }
+
+  /**
+   * \returns The number of dual graph edges cut by the last
+   * partitioning.
+   */
+  dof_id_type edge_cut () const { return _edge_cut; }
+
+protected:
+
+  /**
+   * Partition the \p MeshBase into \p n subdomains.
+   */
+  virtual void _do_partition (MeshBase & mesh,
+                              const unsigned int n) override;
+
+  /**
+   * Repartition the \p MeshBase into \p n subdomains, moving as few
+   * elements as possible.
+   */
+  virtual void _do_repartition (MeshBase & mesh,
+                                const unsigned int n) override;
+
+  /**
+   * The largest allowed ratio of part weight to average part weight.
+   */
+  Real _imbalance_tolerance;
+
+private:
+
+  /**
+   * Does the work for both partitioning and repartitioning.
+   */
+  void multilevel_partition (MeshBase & mesh,
+                             const unsigned int n,
+                             const bool minimize_migration);
+
+  /**
+   * The edge cut of the last partitioning.
+   */
+  dof_id_type _edge_cut;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_MULTILEVEL_PARTITIONER_H
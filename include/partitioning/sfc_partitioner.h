@@ -32,7 +32,12 @@ namespace libMesh
 
 /**
  * The \p SFCPartitioner uses a Hilbert or Morton-ordered space
- * filling curve to partition the elements.
+ * filling curve to partition the elements.  By default each part
+ * gets an equal number of elements; if weights are attached, e.g.
+ * from an \p ElemCostModel, each part gets a piece of the curve with
+ * about equal total weight instead.  Without space filling curve
+ * support the elements are taken in \p LinearPartitioner order, and
+ * weights are still honored, though only on serialized meshes.
  *
  * \author Benjamin S. Kirk
  * \date 2003
@@ -68,6 +73,8 @@ public:
     return libmesh_make_unique<SFCPartitioner>(*this);
   }
 
+  virtual void attach_weights(ErrorVector * weights) override { _weights = weights; }
+
   /**
    * Sets the type of space-filling curve to use.  Valid types are
    * "Hilbert" (the default) and "Morton".
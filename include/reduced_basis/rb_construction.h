@@ -195,6 +195,10 @@ public:
    * (i) Compute the a posteriori error bound for each set of parameters
    * in the training set, (ii) set current_parameters to the parameters that
    * maximize the error bound, and (iii) return the maximum error bound.
+   *
+   * If the RB evaluation supports batch_rb_solve(), the RB solves are
+   * done in batches, concurrently; the theta functions and stability
+   * lower bounds are still evaluated on one thread.
    */
   virtual Real compute_max_error_bound();
 
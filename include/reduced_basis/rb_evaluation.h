@@ -134,6 +134,63 @@ public:
   virtual Real compute_residual_dual_norm(const unsigned int N,
                                           const std::vector<Number> * evaluated_thetas);
 
+  /**
+   * Solves the RB systems of size \p N at several parameters at once,
+   * given the theta functions evaluated at each parameter as
+   * rb_solve() takes them.  The dual norms of their residuals, as
+   * compute_residual_dual_norm() would compute them, are kept in
+   * \p residual_dual_norms and the RB solutions in \p solutions, if
+   * those aren't null.
+   *
+   * The parameters are split into batches which are solved
+   * concurrently.  The systems of a batch are assembled and factored
+   * together, and each row of the residual inner products is applied
+   * to the whole batch while it's in cache.  Unlike rb_solve(), this
+   * only reads the RB data.
+   */
+  void batch_rb_solve(unsigned int N,
+                      const std::vector<const std::vector<Number> *> & evaluated_thetas,
+                      std::vector<Real> * residual_dual_norms,
+                      std::vector<DenseVector<Number>> * solutions = nullptr) const;
+
+  /**
+   * \returns \p true if batch_rb_solve() solves the same systems as
+   * rb_solve(), so that the greedy and batch_rb_solve() may solve
+   * parameters in threaded batches.  Batches bypass overrides of
+   * rb_solve(), compute_residual_dual_norm(),
+   * get_error_bound_normalization() and
+   * RBConstruction::get_RB_error_bound(), so this is only \p true for
+   * an RBEvaluation itself; subclasses which override none of them
+   * may return \p true too.
+   */
+  virtual bool supports_batch_rb_solve() const;
+
+  /**
+   * Performs online solves with \p N basis functions at each of the
+   * parameters in \p mus, as rb_solve() would for each in turn.  The
+   * absolute error bounds (or -1 if evaluate_RB_error_bound is false)
+   * are returned in \p error_bounds, the outputs and their error
+   * bounds in \p outputs and \p output_error_bounds, indexed by
+   * parameter and then by output, and the RB solutions in \p solutions
+   * if it isn't null.
+   *
+   * The theta functions are evaluated for all the parameters at once,
+   * and the RB systems are solved by the batch_rb_solve() above,
+   * which skips the residuals if evaluate_RB_error_bound is false.
+   * The stability lower bounds are computed one parameter at a time,
+   * since they may need to set the current parameters.
+   *
+   * This leaves the current parameters, RB_solution, RB_outputs and
+   * RB_output_error_bounds as they were.  If supports_batch_rb_solve()
+   * is false, this simply calls rb_solve() for each parameter.
+   */
+  void batch_rb_solve(unsigned int N,
+                      const std::vector<RBParameters> & mus,
+                      std::vector<Real> & error_bounds,
+                      std::vector<std::vector<Number>> & outputs,
+                      std::vector<std::vector<Real>> & output_error_bounds,
+                      std::vector<DenseVector<Number>> * solutions = nullptr);
+
   /**
    * Specifies the residual scaling on the denominator to
    * be used in the a posteriori error bound. Override
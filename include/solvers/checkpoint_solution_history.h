@@ -0,0 +1,230 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_CHECKPOINT_SOLUTION_HISTORY_H
+#define LIBMESH_CHECKPOINT_SOLUTION_HISTORY_H
+
+// Local includes
+#include "libmesh/numeric_vector.h"
+#include "libmesh/solution_history.h"
+#include "libmesh/auto_ptr.h" // libmesh_make_unique
+
+// C++ includes
+#include <map>
+#include <set>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * Subclass of Solution History that keeps only a fixed number of
+ * time steps in memory, and recomputes the others from them when
+ * they are retrieved.
+ *
+ * Checkpoints are placed by the binomial schedule of Griewank's
+ * "revolve" algorithm, which minimizes the number of recomputed time
+ * steps for a given number of checkpoints.  If the number of time
+ * steps is given to the constructor, the forward solve places its
+ * checkpoints by that schedule.  Otherwise only the initial
+ * conditions are kept at first, and the first backward step places
+ * them.  On the way back the adjoint solve reuses freed checkpoints
+ * as it recomputes.
+ *
+ * Steps are recomputed by \p DifferentiableSystem::solve(), so the
+ * time solver must reproduce the stored steps exactly, as fixed time
+ * step solvers do; adaptive time solvers aren't supported.  Vectors
+ * stored during an adjoint solve can't be recomputed and are all
+ * kept.  With compression enabled, checkpoints and adjoint vectors
+ * are stored in single precision, which halves their memory at the
+ * cost of a small error in the retrieved values.
+ *
+ * \brief Stores past solutions at optimally placed checkpoints.
+ */
+class CheckpointSolutionHistory : public SolutionHistory
+{
+public:
+
+  /**
+   * Constructor, reference to system to be passed by user.  At most
+   * \p n_checkpoints time steps, including the initial conditions,
+   * are kept in memory besides the latest retrieved one.  If the
+   * number of time steps \p n_steps is known, checkpoints are placed
+   * optimally during the forward solve.
+   */
+  CheckpointSolutionHistory(System & system_,
+                            unsigned int n_checkpoints,
+                            unsigned int n_steps = 0);
+
+  /**
+   * Destructor
+   */
+  ~CheckpointSolutionHistory();
+
+  /**
+   * Virtual function store which we will be overriding to store timesteps
+   */
+  virtual void store(bool is_adjoint_solve, Real time) override;
+
+  /**
+   * Virtual function retrieve which we will be overriding to
+   * retrieve timesteps, recomputing them if necessary
+   */
+  virtual void retrieve(bool is_adjoint_solve, Real time) override;
+
+  /**
+   * Virtual function erase which we will be overriding to erase
+   * timesteps.  Only the latest timestep can be erased.
+   */
+  virtual void erase(Real time) override;
+
+  /**
+   * Definition of the clone function needed for the setter function
+   */
+  virtual std::unique_ptr<SolutionHistory > clone() const override
+  {
+    auto copy = libmesh_make_unique<CheckpointSolutionHistory>
+      (_system, _n_checkpoints, _n_steps);
+    copy->set_compression(_compress);
+    copy->set_overwrite_previously_stored(overwrite_previously_stored);
+    return copy;
+  }
+
+  /**
+   * Turn on compression to store checkpoints and adjoint vectors in
+   * single precision.
+   */
+  void set_compression (bool val)
+  { _compress = val; }
+
+  /**
+   * \returns The number of time steps recomputed so far.
+   */
+  unsigned int n_recomputed_steps () const
+  { return _n_recomputed_steps; }
+
+  /**
+   * \returns The total number of time steps which must be computed to
+   * retrieve \p n_states time steps in reverse order, starting from a
+   * stored one, with \p n_free more checkpoints available.
+   */
+  static std::size_t reversal_cost (unsigned int n_states,
+                                    unsigned int n_free);
+
+private:
+
+  /**
+   * The vectors stored for one time step, as copies or compressed.
+   */
+  struct Snapshot
+  {
+    std::map<std::string, std::unique_ptr<NumericVector<Number>>> vectors;
+    std::map<std::string, std::vector<float>> compressed;
+  };
+
+  /**
+   * Saves the system vectors the forward solve stores into
+   * \p snapshot, or for an adjoint solve the others worth
+   * preserving.
+   */
+  void save (Snapshot & snapshot,
+             bool is_adjoint_solve,
+             bool compress,
+             bool overwrite);
+
+  /**
+   * Adds the names of the system vectors worth preserving to those
+   * the forward solve stores.
+   */
+  void record_primal_names ();
+
+  /**
+   * Copies the vectors in \p snapshot to the system.
+   */
+  void load (const Snapshot & snapshot);
+
+  /**
+   * \returns The index of the time step at \p time, or
+   * \p libMesh::invalid_uint if there isn't one.
+   */
+  unsigned int find_step (Real time) const;
+
+  /**
+   * Recomputes time step \p step into \p _current from the latest
+   * state before it, placing checkpoints along the way if
+   * \p place_checkpoints.
+   */
+  void advance_to (unsigned int step,
+                   bool place_checkpoints);
+
+  /**
+   * Solves the time step after \p step, whose state the system
+   * holds.
+   */
+  void solve_step (unsigned int step);
+
+  /**
+   * \returns The number of time steps to advance before placing the
+   * next checkpoint, when retrieving \p n_states time steps in
+   * reverse order with \p n_free checkpoints available.
+   */
+  static unsigned int optimal_advance (unsigned int n_states,
+                                       unsigned int n_free);
+
+  // A system reference
+  System & _system;
+
+  // The number of checkpoints we may keep
+  unsigned int _n_checkpoints;
+
+  // The expected number of time steps, or 0 if unknown
+  unsigned int _n_steps;
+
+  // Whether to store checkpoints and adjoint vectors compressed
+  bool _compress;
+
+  // The time of every time step stored by the forward solve
+  std::vector<Real> _times;
+
+  // The names of the vectors stored by the forward solve
+  std::set<std::string> _primal_names;
+
+  // The time steps the forward solve will checkpoint
+  std::set<unsigned int> _planned_checkpoints;
+
+  // The checkpointed time steps
+  std::map<unsigned int, Snapshot> _checkpoints;
+
+  // The vectors stored by adjoint solves, for each time step
+  std::map<unsigned int, Snapshot> _adjoint_vectors;
+
+  // The latest stored or recomputed time step
+  Snapshot _current;
+  unsigned int _current_step;
+
+  // Whether we are recomputing a time step, and should ignore any
+  // calls the time solver makes to us meanwhile
+  bool _recomputing;
+
+  unsigned int _n_recomputed_steps;
+};
+
+} // end namespace libMesh
+
+#endif // LIBMESH_CHECKPOINT_SOLUTION_HISTORY_H
@@ -0,0 +1,110 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_JACOBIAN_FREE_SHELL_MATRIX_H
+#define LIBMESH_JACOBIAN_FREE_SHELL_MATRIX_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/shell_matrix.h"
+
+// C++ includes
+#include <memory>
+
+namespace libMesh
+{
+
+// Forward declarations
+class ImplicitSystem;
+
+/**
+ * This class applies the Jacobian of an \p ImplicitSystem with a
+ * residual \p assembly(), such as a \p DifferentiableSystem, at its
+ * current solution without assembling it, by finite differences of
+ * residuals:
+ *
+ * J v ~= (F(u + h v) - F(u)) / h
+ *
+ * F(u) is taken from the system \p rhs, which must hold the residual
+ * of the current solution whenever the matrix is applied, as it does
+ * during the linear solves of a Newton iteration.  Each product costs
+ * one residual assembly.
+ *
+ * The step h is chosen from the norms of u and v as in PETSc's
+ * default matrix-free differencing.  Constrained degrees of freedom
+ * get identity rows, and perturbations are made to satisfy the
+ * constraints, so the operator matches an assembled, constrained
+ * Jacobian.
+ *
+ * This is not a matrix, so it needs a separate preconditioning matrix
+ * and a linear solver which supports shell matrices, e.g. PETSc.
+ */
+class JacobianFreeShellMatrix : public ShellMatrix<Number>
+{
+public:
+  /**
+   * Constructor.  Applies the Jacobian of \p system.
+   */
+  explicit
+  JacobianFreeShellMatrix (ImplicitSystem & system);
+
+  /**
+   * Destructor.
+   */
+  virtual ~JacobianFreeShellMatrix ();
+
+  virtual numeric_index_type m () const override;
+
+  virtual numeric_index_type n () const override;
+
+  virtual void vector_mult (NumericVector<Number> & dest,
+                            const NumericVector<Number> & arg) const override;
+
+  virtual void vector_mult_add (NumericVector<Number> & dest,
+                                const NumericVector<Number> & arg) const override;
+
+  /**
+   * The diagonal isn't available without assembling the Jacobian, so
+   * this is not implemented; precondition with a matrix instead.
+   */
+  virtual void get_diagonal (NumericVector<Number> & dest) const override;
+
+  /**
+   * The relative size of the differencing step.  This defaults to the
+   * square root of the machine epsilon, which balances truncation
+   * and roundoff error for residuals computed to full precision.
+   */
+  Real differencing_parameter;
+
+private:
+
+  ImplicitSystem & _system;
+
+  /**
+   * Work vectors for the perturbed solution and its residual, built
+   * at the first product
+   */
+  mutable std::unique_ptr<NumericVector<Number>> _perturbed_solution,
+    _perturbed_residual;
+};
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_JACOBIAN_FREE_SHELL_MATRIX_H
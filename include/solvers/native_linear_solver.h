@@ -0,0 +1,224 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_NATIVE_LINEAR_SOLVER_H
+#define LIBMESH_NATIVE_LINEAR_SOLVER_H
+
+// Local includes
+#include "libmesh/linear_solver.h"
+
+// C++ includes
+#include <functional>
+#include <memory>
+
+namespace libMesh
+{
+
+// Forward declarations
+template <typename T> class NativePreconditioner;
+
+/**
+ * This class provides Krylov solvers implemented by libMesh itself,
+ * for use with \p DistributedMatrix and \p DistributedVector when no
+ * external solver package is available.  They are written in terms
+ * of the \p SparseMatrix and \p NumericVector interfaces, so they
+ * also work in parallel and with shell matrices.
+ *
+ * The supported solver types are \p CG, \p PIPECG, \p BICGSTAB and
+ * \p GMRES; others fall back to \p CG.  Preconditioning is from the
+ * right for \p BICGSTAB and \p GMRES, so the reported residual is the
+ * true residual for every solver.
+ *
+ * Parallel solves are usually limited by the latency of global
+ * reductions, so the dot products each iteration needs are combined
+ * into as few reductions as possible.  \p PIPECG is the pipelined
+ * conjugate gradient method of Ghysels and Vanroose, which needs a
+ * single reduction per iteration and overlaps it with the
+ * preconditioner and matrix-vector product.  \p GMRES uses classical
+ * Gram-Schmidt with reorthogonalization, which needs two reductions
+ * per iteration however large the Krylov space.  Its restart length
+ * can be set with the "gmres_restart" integer in the
+ * \p SolverConfiguration, and defaults to 30.
+ *
+ * Assembled matrices are preconditioned by a \p NativePreconditioner
+ * of the requested type, unless a user \p Preconditioner is attached.
+ * Shell matrices without a preconditioning matrix can only use Jacobi
+ * preconditioning, from the shell matrix's diagonal.
+ */
+template <typename T>
+class NativeLinearSolver : public LinearSolver<T>
+{
+public:
+  /**
+   * Constructor.
+   */
+  NativeLinearSolver (const libMesh::Parallel::Communicator & comm_in);
+
+  /**
+   * Destructor.
+   */
+  ~NativeLinearSolver ();
+
+  /**
+   * Release all memory and clear data structures.
+   */
+  virtual void clear () override;
+
+  /**
+   * Initialize data structures if not done so already.
+   */
+  virtual void init (const char * name=nullptr) override;
+
+  virtual std::pair<unsigned int, Real>
+  solve (SparseMatrix<T> & matrix,
+         NumericVector<T> & solution,
+         NumericVector<T> & rhs,
+         const double tol,
+         const unsigned int m_its) override;
+
+  /**
+   * Solves with \p matrix, using a preconditioner built from \p pc.
+   */
+  virtual std::pair<unsigned int, Real>
+  solve (SparseMatrix<T> & matrix,
+         SparseMatrix<T> & pc,
+         NumericVector<T> & solution,
+         NumericVector<T> & rhs,
+         const double tol,
+         const unsigned int m_its) override;
+
+  /**
+   * This function solves a system whose matrix is a shell matrix.
+   */
+  virtual std::pair<unsigned int, Real>
+  solve (const ShellMatrix<T> & shell_matrix,
+         NumericVector<T> & solution,
+         NumericVector<T> & rhs,
+         const double tol,
+         const unsigned int m_its) override;
+
+  /**
+   * This function solves a system whose matrix is a shell matrix,
+   * using a preconditioner built from \p precond_matrix.
+   */
+  virtual std::pair<unsigned int, Real>
+  solve (const ShellMatrix<T> & shell_matrix,
+         const SparseMatrix<T> & precond_matrix,
+         NumericVector<T> & solution,
+         NumericVector<T> & rhs,
+         const double tol,
+         const unsigned int m_its) override;
+
+  /**
+   * \returns The solver's convergence flag
+   */
+  virtual LinearConvergenceReason get_converged_reason() const override;
+
+private:
+
+  /**
+   * Computes dest = A*arg for the system matrix A.
+   */
+  typedef std::function<void (NumericVector<T> &, const NumericVector<T> &)> Operator;
+
+  /**
+   * Sets up the preconditioner, from \p pc if it is given and from
+   * the diagonal of \p shell_matrix otherwise.
+   */
+  void init_preconditioner (const NumericVector<T> & solution,
+                            SparseMatrix<T> * pc,
+                            const ShellMatrix<T> * shell_matrix);
+
+  /**
+   * Computes dest = M^{-1}*arg for the preconditioner M.
+   */
+  void apply_preconditioner (NumericVector<T> & dest,
+                             const NumericVector<T> & arg);
+
+  /**
+   * Dispatches to the solver selected by \p _solver_type.
+   */
+  std::pair<unsigned int, Real>
+  solve_system (const Operator & A,
+                NumericVector<T> & solution,
+                const NumericVector<T> & rhs,
+                const double tol,
+                const unsigned int m_its);
+
+  /**
+   * Preconditioned conjugate gradients.  This and the other solvers
+   * iterate until the residual norm is at most \p target.
+   */
+  std::pair<unsigned int, Real>
+  cg (const Operator & A,
+      NumericVector<T> & x,
+      const NumericVector<T> & b,
+      const Real target,
+      const unsigned int m_its);
+
+  /**
+   * Pipelined preconditioned conjugate gradients.
+   */
+  std::pair<unsigned int, Real>
+  pipelined_cg (const Operator & A,
+                NumericVector<T> & x,
+                const NumericVector<T> & b,
+                const Real target,
+                const unsigned int m_its);
+
+  /**
+   * Right preconditioned BiCGStab.
+   */
+  std::pair<unsigned int, Real>
+  bicgstab (const Operator & A,
+            NumericVector<T> & x,
+            const NumericVector<T> & b,
+            const Real target,
+            const unsigned int m_its);
+
+  /**
+   * Right preconditioned restarted GMRES.
+   */
+  std::pair<unsigned int, Real>
+  gmres (const Operator & A,
+         NumericVector<T> & x,
+         const NumericVector<T> & b,
+         const Real target,
+         const unsigned int m_its);
+
+  /**
+   * The preconditioner built from the preconditioning matrix.
+   */
+  std::unique_ptr<NativePreconditioner<T>> _native_preconditioner;
+
+  /**
+   * The inverse of the diagonal of a shell matrix, for Jacobi
+   * preconditioning without a preconditioning matrix.
+   */
+  std::unique_ptr<NumericVector<T>> _diagonal_inverse;
+
+  /**
+   * The result of the last solve.
+   */
+  LinearConvergenceReason _converged_reason;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_NATIVE_LINEAR_SOLVER_H
@@ -27,6 +27,8 @@
 #include "libmesh/diff_solver.h"
 
 // C++ includes
+#include <memory>
+#include <vector>
 
 namespace libMesh
 {
@@ -142,6 +144,65 @@ public:
    */
   double linear_tolerance_multiplier;
 
+  /**
+   * The number of Newton iterations which may reuse an assembled
+   * Jacobian, and the preconditioner built from it, before the
+   * Jacobian is assembled again.  Iterations which reuse the Jacobian
+   * only assemble the residual.
+   * It is currently set to 0 by default, which assembles the Jacobian
+   * at every iteration.
+   */
+  unsigned int max_jacobian_lag;
+
+  /**
+   * If a Newton iteration reduces the residual by less than this
+   * factor, the Jacobian is assembled again at the next iteration,
+   * even if max_jacobian_lag would allow reusing it.  An iteration
+   * with a reused Jacobian which doesn't reduce the residual at all is
+   * retried with a new Jacobian.
+   * It is currently set to 0.5 by default.
+   */
+  Real lagged_jacobian_reduction;
+
+  /**
+   * If this is nonzero, the steps taken with a reused Jacobian are
+   * improved by Anderson mixing with up to this many of the previous
+   * steps taken with the same Jacobian.  Anderson mixing is a
+   * multisecant generalization of Broyden's method, which corrects
+   * the reused Jacobian with what the recent steps revealed of the
+   * current one.
+   * It is currently set to 0 by default.
+   */
+  unsigned int anderson_depth;
+
+  /**
+   * If this is set to true, the linear tolerance for each step is
+   * chosen by the second Eisenstat-Walker formula, from how quickly
+   * the nonlinear residual has been dropping, instead of by
+   * linear_tolerance_multiplier.  Linear solves are then loose far
+   * from the solution and tighten as Newton converges.
+   * It is currently set to false by default.
+   */
+  bool eisenstat_walker_tolerance;
+
+  /**
+   * If this is set to true, the linear solves use the action of the
+   * Jacobian, found by finite differences of residuals, instead of
+   * the assembled Jacobian, which then only builds the
+   * preconditioner.  The element Jacobians of the system may then be
+   * approximate, e.g. lower order, block diagonal or missing
+   * expensive terms, without slowing nonlinear convergence, and
+   * max_jacobian_lag lets them be assembled only occasionally.  A
+   * "Preconditioner" matrix on the system is used instead of the
+   * system matrix if there is one.
+   *
+   * Each linear iteration costs a residual assembly, and the linear
+   * solver must support shell matrices, as PETSc's does.  Steps aren't
+   * Anderson mixed, since they already use the current Jacobian.
+   * It is currently set to false by default.
+   */
+  bool jacobian_free;
+
 protected:
 
   /**
@@ -181,6 +242,32 @@ protected:
   bool test_convergence(Real current_residual,
                         Real step_norm,
                         bool linear_solve_finished);
+
+  /**
+   * Records \p newton_iterate and the (negative) step \p
+   * linear_solution found for it with a reused Jacobian, and replaces
+   * \p linear_solution with the Anderson mixed step.
+   */
+  void anderson_mix(const NumericVector<Number> & newton_iterate,
+                    NumericVector<Number> & linear_solution);
+
+  /**
+   * Forgets the steps recorded for Anderson mixing, which is
+   * necessary whenever the Jacobian changes.
+   */
+  void clear_anderson_history();
+
+  /**
+   * The last iterate and step recorded for Anderson mixing
+   */
+  std::unique_ptr<NumericVector<Number>> _anderson_iterate, _anderson_step;
+
+  /**
+   * The differences between successive recorded iterates and steps,
+   * oldest first
+   */
+  std::vector<std::unique_ptr<NumericVector<Number>>> _anderson_iterate_diffs,
+    _anderson_step_diffs;
 };
 
 
@@ -92,6 +92,16 @@ public:
    */
   virtual unsigned int solve () override;
 
+  /**
+   * If this is set to true, SNES applies the Jacobian by finite
+   * differences of residuals, as with -snes_mf_operator, and the
+   * assembled Jacobian only builds the preconditioner, so the element
+   * Jacobians of the system may be approximate.  Preconditioner
+   * lagging is then controlled by -snes_lag_jacobian.
+   * It is currently set to false by default.
+   */
+  bool jacobian_free;
+
 protected:
 
   /**
@@ -32,6 +32,7 @@ namespace libMesh
 
 // Forward Declarations
 class DiffContext;
+class ElemCostModel;
 class FEMContext;
 
 
@@ -169,6 +170,14 @@ public:
    */
   bool fe_reinit_during_postprocess;
 
+  /**
+   * If elem_cost_model is set (it is null by default), assembly()
+   * times the assembly of each element and adds the times to it as
+   * samples, so that it can calibrate weights for partitioning.
+   * The model is not owned by the system.
+   */
+  ElemCostModel * elem_cost_model;
+
   /**
    * If calculating numeric jacobians is required, the FEMSystem
    * will perturb each solution vector entry by numerical_jacobian_h
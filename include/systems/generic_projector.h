@@ -21,10 +21,12 @@
 #define GENERIC_PROJECTOR_H
 
 // C++ includes
+#include <map>
 #include <vector>
 
 // libMesh includes
 #include "libmesh/dense_matrix.h"
+#include "libmesh/dense_matrix_batch.h"
 #include "libmesh/dense_vector.h"
 #include "libmesh/dof_map.h"
 #include "libmesh/elem.h"
@@ -258,6 +260,22 @@ public:
        unsigned int var_component,
        const Node * node,
        const FEGenericBase<typename FFunctor::RealType> & fe);
+
+    // Solve all the projections constructed so far, and insert their
+    // results
+    void solve_projections();
+
+    // Projection systems awaiting a solve.  Each stage produces many
+    // small systems of only a few different sizes, so we group them
+    // by size and factor each group together.
+    struct PendingProjections {
+      DenseMatrixBatch<Real> matrices;
+      std::vector<DenseVector<typename FFunctor::ValuePushType>> rhs;
+      std::vector<std::vector<dof_id_type>> free_dof_ids;
+      std::vector<processor_id_type> pids;
+    };
+
+    std::map<unsigned int, PendingProjections> pending_projections;
   };
 
 
@@ -383,6 +401,11 @@ public:
  * GenericProjector to set projection values (which must be of type
  * Val) as coefficients of the given NumericVector.
  *
+ * Each (thread-private) copy of the action stages the values it is
+ * given, and sets them all at once when it is flushed or destroyed,
+ * so that threads contend for the target vector once rather than
+ * once per value.
+ *
  * \author Roy H. Stogner
  * \date 2016
  */
@@ -393,20 +416,26 @@ class VectorSetAction
 private:
   NumericVector<Val> & target_vector;
 
+  std::vector<numeric_index_type> staged_ids;
+  std::vector<Val> staged_vals;
+
 public:
   typedef Val InsertInput;
 
   VectorSetAction(NumericVector<Val> & target_vec) :
     target_vector(target_vec) {}
 
+  // Copies share the target vector but start with nothing staged
+  VectorSetAction(const VectorSetAction & other) :
+    target_vector(other.target_vector) {}
+
+  ~VectorSetAction() { this->flush(); }
+
   void insert(dof_id_type id,
               Val val)
   {
-    // Lock the new vector since it is shared among threads.
-    {
-      Threads::spin_mutex::scoped_lock lock(Threads::spin_mtx);
-      target_vector.set(id, val);
-    }
+    staged_ids.push_back(id);
+    staged_vals.push_back(val);
   }
 
 
@@ -421,16 +450,29 @@ public:
 
     libmesh_assert_equal_to(size, dof_indices.size());
 
+    for (unsigned int i = 0; i != size; ++i)
+      if ((dof_indices[i] >= first) && (dof_indices[i] <  last))
+        {
+          staged_ids.push_back(dof_indices[i]);
+          staged_vals.push_back(Ue(i));
+        }
+  }
+
+
+  void flush()
+  {
+    if (staged_ids.empty())
+      return;
+
     // Lock the new vector since it is shared among threads.
     {
       Threads::spin_mutex::scoped_lock lock(Threads::spin_mtx);
-
-      for (unsigned int i = 0; i != size; ++i)
-        if ((dof_indices[i] >= first) && (dof_indices[i] <  last))
-          target_vector.set(dof_indices[i], Ue(i));
+      target_vector.insert(staged_vals, staged_ids);
     }
-  }
 
+    staged_ids.clear();
+    staged_vals.clear();
+  }
 };
 
 
@@ -2386,6 +2428,8 @@ void GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::ProjectEdge
              &edge_node, proj_fe);
         }
     }
+
+  this->solve_projections();
 }
 
 
@@ -2567,6 +2611,8 @@ void GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::ProjectSide
              &side_node, proj_fe);
         }
     }
+
+  this->solve_projections();
 }
 
 
@@ -2708,6 +2754,8 @@ void GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::ProjectInte
              nullptr, *fe);
         } // end variables loop
     } // end elements loop
+
+  this->solve_projections();
 }
 
 
@@ -2923,8 +2971,6 @@ GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::SubProjector::co
   // support is enabled
   DenseMatrix<Real> Ke(free_dofs, free_dofs);
   DenseVector<typename FFunctor::ValuePushType> Fe(free_dofs);
-  // The new degree of freedom coefficients to solve for
-  DenseVector<typename FFunctor::ValuePushType> Ufree(free_dofs);
 
   const unsigned int n_qp =
     cast_int<unsigned int>(xyz_values.size());
@@ -2988,12 +3034,49 @@ GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::SubProjector::co
         }
     }
 
-  Ke.cholesky_solve(Fe, Ufree);
+  // Save the system to be solved along with the others of its size
+  PendingProjections & pending = pending_projections[free_dofs];
+  if (pending.matrices.empty())
+    pending.matrices.resize(free_dofs);
+  pending.matrices.add_matrix(Ke);
+  pending.rhs.push_back(std::move(Fe));
+  pending.free_dof_ids.push_back(std::move(free_dof_ids));
+  pending.pids.push_back(node ?
+                         node->processor_id() :
+                         DofObject::invalid_processor_id);
+}
+
+
+
+template <typename FFunctor, typename GFunctor,
+          typename FValue, typename ProjectionAction>
+void
+GenericProjector<FFunctor, GFunctor, FValue, ProjectionAction>::SubProjector::solve_projections()
+{
+  DenseVector<typename FFunctor::ValuePushType> Ufree;
+
+  for (auto & size_pending : pending_projections)
+    {
+      PendingProjections & pending = size_pending.second;
+
+      if (pending.matrices.empty())
+        continue;
+
+      pending.matrices.cholesky_decompose();
 
-  // Transfer new edge solutions to element
-  const processor_id_type pid = node ?
-    node->processor_id() : DofObject::invalid_processor_id;
-  insert_ids(free_dof_ids, Ufree.get_values(), pid);
+      // Transfer new edge solutions to element
+      for (auto k : index_range(pending.rhs))
+        {
+          pending.matrices.cholesky_back_substitute(k, pending.rhs[k], Ufree);
+          insert_ids(pending.free_dof_ids[k], Ufree.get_values(), pending.pids[k]);
+        }
+
+      // Keep the storage around for the next range
+      pending.matrices.clear();
+      pending.rhs.clear();
+      pending.free_dof_ids.clear();
+      pending.pids.clear();
+    }
 }
 
 
@@ -33,6 +33,7 @@ namespace libMesh
 // Forward declarations
 template <typename T> class LinearSolver;
 template <typename T> class SparseMatrix;
+class StaticCondensation;
 
 /**
  * \brief Manages consistently variables, degrees of freedom, coefficient
@@ -390,6 +391,8 @@ public:
    */
   virtual unsigned int n_matrices () const override;
 
+  virtual std::size_t memory_usage () const override;
+
   /**
    * The system matrix.  Implicit systems are characterized by
    * the need to solve the linear system Ax=b.  This is the
@@ -397,6 +400,28 @@ public:
    */
   SparseMatrix<Number> * matrix;
 
+  /**
+   * Enables static condensation of the dofs interior to single
+   * elements.  Assembly must then add each element matrix and vector
+   * through \p StaticCondensation::add_element_system(), and solvers
+   * which support condensation solve the reduced system instead of
+   * \p matrix and \p rhs.  The system \p matrix is then left
+   * uninitialized, or is released if it was already initialized.
+   */
+  void enable_static_condensation ();
+
+  /**
+   * \returns \p true if static condensation is enabled.
+   */
+  bool has_static_condensation () const
+  { return _static_condensation.get(); }
+
+  /**
+   * \returns The static condensation of this system.  Only valid
+   * after \p enable_static_condensation().
+   */
+  StaticCondensation & get_static_condensation ();
+
   /**
    * By default, the system will zero out the matrix and the right hand side.
    * If this flag is false, it is the responsibility of the client code
@@ -439,6 +464,11 @@ private:
    * \p true when additional matrices may still be added, \p false otherwise.
    */
   bool _can_add_matrices;
+
+  /**
+   * The static condensation of interior dofs, if enabled.
+   */
+  std::unique_ptr<StaticCondensation> _static_condensation;
 };
 
 
@@ -0,0 +1,245 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_STATIC_CONDENSATION_H
+#define LIBMESH_STATIC_CONDENSATION_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/dense_matrix.h"
+#include "libmesh/dense_vector.h"
+#include "libmesh/id_types.h"
+#include "libmesh/parallel_object.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class ImplicitSystem;
+template <typename T> class NumericVector;
+template <typename T> class SparseMatrix;
+
+/**
+ * Static condensation of the element-interior dofs of an
+ * \p ImplicitSystem.
+ *
+ * Dofs which are interior to a single element (see
+ * \p DofMap::mark_interior_dofs()) couple only to the other dofs of
+ * that element.  Each element matrix can therefore be reduced, before
+ * insertion, to the Schur complement on its remaining dofs, so the
+ * global system only involves the dofs on element boundaries.  For
+ * high order hierarchic and Bernstein bases most of the dofs are
+ * interior, so the reduced system is far smaller.
+ *
+ * Assembly code inserts each element matrix and vector through
+ * \p add_element_system() instead of into the system matrix and rhs.
+ * Each element must be added exactly once per assembly, with its
+ * complete matrix and vector, since the condensation is not linear.
+ * After the reduced system is solved, \p recover_solution() computes
+ * the interior dofs element by element.
+ *
+ * Only \p LinearImplicitSystem::solve() currently solves the reduced
+ * system and recovers the interior dofs; the other solvers of
+ * \p ImplicitSystem subclasses do not support condensation.
+ *
+ * The reduced matrix is preallocated row by row from the system's
+ * full sparsity pattern when it is a \p PetscMatrix, and otherwise
+ * with the matrix package's generic \p init() and the largest row
+ * counts, so packages which only support DofMap-based
+ * initialization can't be used.
+ */
+class StaticCondensation : public ParallelObject
+{
+public:
+
+  /**
+   * Constructor.
+   */
+  explicit
+  StaticCondensation (ImplicitSystem & system);
+
+  /**
+   * Destructor.
+   */
+  ~StaticCondensation ();
+
+  /**
+   * Marks the interior dofs of the system, numbers the remaining
+   * dofs, and builds the reduced matrix and vectors.  Must be called
+   * on all processors whenever dofs are redistributed.
+   */
+  void init ();
+
+  /**
+   * Releases the reduced matrix, vectors and element data.
+   */
+  void clear ();
+
+  /**
+   * \returns \p true if \p init() has been called since the last
+   * \p clear().
+   */
+  bool initialized () const { return _reduced_matrix.get(); }
+
+  /**
+   * Zeroes the reduced matrix and rhs, and discards the element data
+   * from any previous assembly.
+   */
+  void zero ();
+
+  /**
+   * Condenses the element matrix \p Ke and vector \p Fe, whose rows
+   * and columns correspond to \p dof_indices, and adds the result to
+   * the reduced matrix and rhs.  The interior block of \p Ke must be
+   * nonsingular.
+   *
+   * This may be called concurrently from multiple threads.
+   */
+  void add_element_system (const DenseMatrix<Number> & Ke,
+                           const DenseVector<Number> & Fe,
+                           const std::vector<dof_id_type> & dof_indices);
+
+  /**
+   * \returns The global number of dofs in the reduced system.
+   */
+  dof_id_type n_reduced_dofs () const { return _n_reduced_dofs; }
+
+  /**
+   * \returns The index in the reduced system of the dof \p dof, or
+   * \p DofObject::invalid_id if \p dof is interior.  \p dof must be
+   * local or in the system's send list.
+   */
+  dof_id_type reduced_dof (const dof_id_type dof) const;
+
+  /**
+   * \returns The reduced matrix.
+   */
+  SparseMatrix<Number> & get_reduced_matrix ();
+
+  /**
+   * \returns The reduced rhs.
+   */
+  NumericVector<Number> & get_reduced_rhs ();
+
+  /**
+   * \returns The solution of the reduced system.
+   */
+  NumericVector<Number> & get_reduced_solution ();
+
+  /**
+   * Copies the non-interior entries of \p solution into the reduced
+   * solution, e.g. as an initial guess for an iterative solve.
+   */
+  void restrict_solution (const NumericVector<Number> & solution);
+
+  /**
+   * Copies the reduced solution into the non-interior entries of
+   * \p solution, and computes its interior entries from the element
+   * data of the last assembly.  The elements are processed in
+   * parallel on threads.
+   */
+  void recover_solution (NumericVector<Number> & solution);
+
+private:
+
+  /**
+   * Threaded body computing the interior dofs for a range of the
+   * element data.
+   */
+  class RecoverInterior;
+
+  /**
+   * The data needed to recover the interior dofs of an element,
+   * \f$ u_I = K_{II}^{-1} F_I - K_{II}^{-1} K_{IB} u_B \f$.
+   */
+  struct ElemData
+  {
+    // The global indices of the interior dofs
+    std::vector<dof_id_type> interior_dofs;
+
+    // The reduced indices of the remaining dofs
+    std::vector<dof_id_type> reduced_dofs;
+
+    // K_II^{-1} K_IB
+    DenseMatrix<Number> interior_coupling;
+
+    // K_II^{-1} F_I
+    DenseVector<Number> interior_rhs;
+  };
+
+  /**
+   * The system we condense.
+   */
+  ImplicitSystem & _system;
+
+  /**
+   * The global number of reduced dofs.
+   */
+  dof_id_type _n_reduced_dofs;
+
+  /**
+   * The reduced index of each local dof, or \p DofObject::invalid_id
+   * for interior dofs.
+   */
+  std::vector<dof_id_type> _local_reduced_dofs;
+
+  /**
+   * The reduced index of each nonlocal dof in the send list, or
+   * \p DofObject::invalid_id for interior dofs.
+   */
+  std::unordered_map<dof_id_type, dof_id_type> _ghost_reduced_dofs;
+
+  /**
+   * The reduced indices of the non-interior dofs in the send list.
+   */
+  std::vector<numeric_index_type> _reduced_send_list;
+
+  std::unique_ptr<SparseMatrix<Number>> _reduced_matrix;
+
+  std::unique_ptr<NumericVector<Number>> _reduced_rhs;
+
+  std::unique_ptr<NumericVector<Number>> _reduced_solution;
+
+  /**
+   * The reduced solution, with the ghost entries needed for recovery.
+   */
+  std::unique_ptr<NumericVector<Number>> _reduced_local_solution;
+
+  /**
+   * The element data from the current assembly.
+   */
+  std::vector<ElemData> _elem_data;
+
+  /**
+   * Guards \p _elem_data and insertion into the reduced system
+   * during threaded assembly, and insertion into the solution during
+   * threaded recovery.
+   */
+  Threads::spin_mutex _mutex;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_STATIC_CONDENSATION_H
@@ -1045,6 +1045,13 @@ public:
    */
   virtual unsigned int n_matrices () const;
 
+  /**
+   * \returns An estimate of the memory, in bytes, used on this
+   * processor by the \p DofMap, vectors and matrices of this system.
+   * Derived classes should add any other large data they own.
+   */
+  virtual std::size_t memory_usage () const;
+
   /**
    * \returns The number of variables in the system
    */
@@ -1769,6 +1776,19 @@ protected:
                        NumericVector<Number> &,
                        int is_adjoint = -1) const;
 
+  /**
+   * Projects each of the \p vectors defined on the old mesh onto the
+   * new mesh, constraining \p vectors[i] as project_vector() would
+   * for \p is_adjoint[i].
+   *
+   * When possible, the local projection operator on each element is
+   * computed only once and applied to all of the vectors, which is
+   * much cheaper than repeated project_vector() calls for systems
+   * with many preserved vectors.
+   */
+  void project_vectors (const std::vector<NumericVector<Number> *> & vectors,
+                        const std::vector<int> & is_adjoint) const;
+
 private:
   /**
    * This isn't a copyable object, so let's make sure nobody tries.
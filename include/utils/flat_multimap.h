@@ -0,0 +1,366 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FLAT_MULTIMAP_H
+#define LIBMESH_FLAT_MULTIMAP_H
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+
+// C++ Includes   -----------------------------------
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This \p FlatMultimap templated class stores the entries of a
+ * multimap in a sorted std::vector, with an interface resembling that
+ * of a std::multimap, for large maps which are mostly read.
+ *
+ * Entries which are inserted are staged in a small std::multimap, and
+ * entries which are erased are only marked as erased, so that edits
+ * don't have to move the whole sorted vector.  \p finalize() merges
+ * the staged entries into the sorted vector and drops the erased
+ * ones; it is also called automatically when the staged or erased
+ * entries grow comparable in number to the sorted ones.
+ *
+ * Lookups see staged and erased entries correctly at any time, and
+ * never modify the map, so they are safe to do concurrently.  Entries
+ * are visited in key order, and entries with equal keys in the order
+ * they were inserted, as in a std::multimap.
+ *
+ * \note Iterators, including those from \p equal_range(), are
+ * invalidated by any insertion or erasure, since those may finalize
+ * the map; look ranges up again after editing.  Iterators dereference
+ * to a copy of the entry, so there is no \p operator->().
+ */
+template <typename Key, typename T>
+class FlatMultimap
+{
+public:
+
+  typedef Key                      key_type;
+  typedef T                        mapped_type;
+  typedef std::pair<Key, T>        value_type;
+  typedef std::vector<value_type>  vector_type;
+  typedef std::multimap<Key, T>    staged_type;
+
+  /**
+   * Iterates over the sorted entries which are not erased and the
+   * staged entries within a range of keys, merged in key order.
+   * Sorted entries come first among equal keys, since they were
+   * inserted first.
+   */
+  class const_iterator
+  {
+  public:
+    typedef std::input_iterator_tag iterator_category;
+    typedef typename FlatMultimap::value_type value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef void pointer;
+    typedef value_type reference;
+
+    const_iterator (const FlatMultimap & map,
+                    std::size_t i,
+                    std::size_t i_end,
+                    typename staged_type::const_iterator s,
+                    typename staged_type::const_iterator s_end) :
+      _map(&map), _i(i), _i_end(i_end), _s(s), _s_end(s_end)
+    { this->skip_erased(); }
+
+    value_type operator* () const
+    {
+      if (this->at_sorted())
+        return _map->_sorted[_i];
+      return value_type(_s->first, _s->second);
+    }
+
+    const_iterator & operator++ ()
+    {
+      if (this->at_sorted())
+        {
+          ++_i;
+          this->skip_erased();
+        }
+      else
+        ++_s;
+      return *this;
+    }
+
+    const_iterator operator++ (int)
+    {
+      const_iterator it = *this;
+      ++(*this);
+      return it;
+    }
+
+    bool operator== (const const_iterator & other) const
+    { return _i == other._i && _s == other._s; }
+
+    bool operator!= (const const_iterator & other) const
+    { return !(*this == other); }
+
+  private:
+    // Whether the next entry is a sorted one rather than a staged one
+    bool at_sorted () const
+    {
+      return _i != _i_end &&
+        (_s == _s_end || !(_s->first < _map->_sorted[_i].first));
+    }
+
+    void skip_erased ()
+    {
+      while (_i != _i_end && _map->is_erased(_i))
+        ++_i;
+    }
+
+    const FlatMultimap * _map;
+    std::size_t _i, _i_end;
+    typename staged_type::const_iterator _s, _s_end;
+  };
+
+  typedef const_iterator iterator;
+
+  /**
+   * Inserts an entry mapping \p key to \p val.
+   */
+  void emplace (const Key & key, const T & val)
+  {
+    _staged.emplace(key, val);
+    if (_staged.size() > std::max(_sorted.size(), min_staged))
+      this->finalize();
+  }
+
+  /**
+   * \returns The first and past-the-end iterators over the entries
+   * with key \p key.
+   */
+  std::pair<const_iterator, const_iterator> equal_range (const Key & key) const
+  {
+    const std::pair<std::size_t, std::size_t> sorted = this->sorted_range(key);
+    const auto staged = _staged.equal_range(key);
+    return std::make_pair(const_iterator(*this, sorted.first, sorted.second,
+                                         staged.first, staged.second),
+                          const_iterator(*this, sorted.second, sorted.second,
+                                         staged.second, staged.second));
+  }
+
+  const_iterator begin () const
+  {
+    return const_iterator(*this, 0, _sorted.size(),
+                          _staged.begin(), _staged.end());
+  }
+
+  const_iterator end () const
+  {
+    return const_iterator(*this, _sorted.size(), _sorted.size(),
+                          _staged.end(), _staged.end());
+  }
+
+  /**
+   * \returns The number of entries.
+   */
+  std::size_t size () const
+  { return _sorted.size() - _n_erased + _staged.size(); }
+
+  bool empty () const
+  { return !this->size(); }
+
+  /**
+   * Erases every entry.
+   */
+  void clear ()
+  {
+    _sorted.clear();
+    _erased.clear();
+    _n_erased = 0;
+    _staged.clear();
+  }
+
+  /**
+   * Erases the entries with key \p key.
+   */
+  void erase (const Key & key)
+  {
+    this->erase_if(key, [](const T &){ return true; });
+  }
+
+  /**
+   * Erases the entries with key \p key whose values satisfy \p pred.
+   */
+  template <typename Pred>
+  void erase_if (const Key & key, Pred pred)
+  {
+    const std::pair<std::size_t, std::size_t> sorted = this->sorted_range(key);
+    for (std::size_t i = sorted.first; i != sorted.second; ++i)
+      if (!this->is_erased(i) && pred(_sorted[i].second))
+        this->mark_erased(i);
+
+    auto staged = _staged.equal_range(key);
+    for (auto it = staged.first; it != staged.second;)
+      {
+        if (pred(it->second))
+          it = _staged.erase(it);
+        else
+          ++it;
+      }
+
+    this->compact_if_sparse();
+  }
+
+  /**
+   * Erases every entry whose value satisfies \p pred.
+   */
+  template <typename Pred>
+  void erase_if (Pred pred)
+  {
+    for (std::size_t i = 0; i != _sorted.size(); ++i)
+      if (!this->is_erased(i) && pred(_sorted[i].second))
+        this->mark_erased(i);
+
+    for (auto it = _staged.begin(); it != _staged.end();)
+      {
+        if (pred(it->second))
+          it = _staged.erase(it);
+        else
+          ++it;
+      }
+
+    this->compact_if_sparse();
+  }
+
+  /**
+   * Merges the staged entries into the sorted vector, drops the
+   * erased entries and releases the storage they used.
+   */
+  void finalize ()
+  {
+    if (_staged.empty() && !_n_erased)
+      return;
+
+    vector_type merged;
+    merged.reserve(this->size());
+
+    // Sorted entries come first among equal keys, since they were
+    // inserted first.
+    auto s = _staged.begin();
+    for (std::size_t i = 0; i != _sorted.size(); ++i)
+      {
+        if (this->is_erased(i))
+          continue;
+        for (; s != _staged.end() && s->first < _sorted[i].first; ++s)
+          merged.emplace_back(s->first, s->second);
+        merged.push_back(_sorted[i]);
+      }
+    for (; s != _staged.end(); ++s)
+      merged.emplace_back(s->first, s->second);
+
+    _sorted.swap(merged);
+    _erased.clear();
+    _erased.shrink_to_fit();
+    _n_erased = 0;
+    _staged.clear();
+  }
+
+  /**
+   * \returns \p true if there are no staged or erased entries.
+   */
+  bool finalized () const
+  { return _staged.empty() && !_n_erased; }
+
+  /**
+   * \returns The heap memory held by the map, in bytes.
+   */
+  std::size_t memory_usage () const
+  {
+    return _sorted.capacity() * sizeof(value_type) +
+      _erased.capacity() / 8 +
+      _staged.size() * (sizeof(typename staged_type::value_type) + 4*sizeof(void *));
+  }
+
+private:
+
+  /**
+   * Fewer staged entries than this are never worth merging early.
+   */
+  static const std::size_t min_staged = 1024;
+
+  struct KeyOrder
+  {
+    bool operator() (const value_type & lhs, const Key & rhs) const
+    { return lhs.first < rhs; }
+    bool operator() (const Key & lhs, const value_type & rhs) const
+    { return lhs < rhs.first; }
+  };
+
+  std::pair<std::size_t, std::size_t> sorted_range (const Key & key) const
+  {
+    const auto range =
+      std::equal_range(_sorted.begin(), _sorted.end(), key, KeyOrder());
+    return std::make_pair(std::size_t(range.first - _sorted.begin()),
+                          std::size_t(range.second - _sorted.begin()));
+  }
+
+  bool is_erased (std::size_t i) const
+  { return _n_erased && _erased[i]; }
+
+  void mark_erased (std::size_t i)
+  {
+    if (_erased.empty())
+      _erased.resize(_sorted.size(), false);
+    _erased[i] = true;
+    ++_n_erased;
+  }
+
+  void compact_if_sparse ()
+  {
+    if (_n_erased > std::max(_sorted.size() / 2, min_staged))
+      this->finalize();
+  }
+
+  /**
+   * The finalized entries, sorted by key.
+   */
+  vector_type _sorted;
+
+  /**
+   * Which sorted entries have been erased, if any have been.
+   */
+  std::vector<bool> _erased;
+
+  std::size_t _n_erased = 0;
+
+  /**
+   * The entries inserted since the map was last finalized.
+   */
+  staged_type _staged;
+};
+
+template <typename Key, typename T>
+const std::size_t FlatMultimap<Key, T>::min_staged;
+
+} // namespace libMesh
+
+#endif // LIBMESH_FLAT_MULTIMAP_H
@@ -0,0 +1,172 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_HARDWARE_COUNTERS_H
+#define LIBMESH_HARDWARE_COUNTERS_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace libMesh
+{
+
+/**
+ * The \p HardwareCounters class reads the hardware performance
+ * counters of the CPU through the Linux \p perf_event_open() system
+ * call.  It counts cycles, instructions, last level cache references
+ * and misses, branch misses and, if the raw event which counts them
+ * on this CPU is given, floating point operations.
+ *
+ * The counters count only the thread which opened them, in user
+ * space, from the moment they are opened.  Counters the CPU or kernel
+ * doesn't provide, e.g. in many virtual machines or when
+ * /proc/sys/kernel/perf_event_paranoid forbids them, are left out and
+ * read as zero.  On other systems no counters are available at all.
+ *
+ * \brief Reads the CPU performance counters of one thread.
+ */
+class HardwareCounters
+{
+public:
+
+  /**
+   * The counters we try to open.
+   */
+  enum Counter : unsigned int
+    {
+      CYCLES = 0,
+      INSTRUCTIONS,
+      CACHE_REFERENCES,
+      CACHE_MISSES,
+      BRANCH_MISSES,
+      FLOPS,
+      N_COUNTERS
+    };
+
+  /**
+   * The value of every counter.
+   */
+  typedef std::array<std::uint64_t, N_COUNTERS> Values;
+
+  /**
+   * Constructor.  No counters are open until \p open() is called.
+   */
+  HardwareCounters ();
+
+  /**
+   * Destructor.  Closes the counters.
+   */
+  ~HardwareCounters ();
+
+  /**
+   * Opens and starts the counters for the calling thread.  If
+   * \p flop_event is nonzero, it is the raw event code which counts
+   * floating point operations on this CPU, as listed by
+   * "perf list --details" or in the vendor's documentation.
+   *
+   * \returns \p true if any counters could be opened.
+   */
+  bool open (std::uint64_t flop_event = 0);
+
+  /**
+   * Closes the counters.
+   */
+  void close ();
+
+  /**
+   * \returns \p true iff any counters are open.
+   */
+  bool enabled () const
+  { return _group_fd >= 0; }
+
+  /**
+   * \returns \p true iff \p counter is open.
+   */
+  bool available (Counter counter) const
+  { return _position[counter] >= 0; }
+
+  /**
+   * Reads every counter, scaled up to make up for any time the
+   * kernel had to share the hardware with other counters.
+   * Counters which aren't available read as zero.
+   */
+  void read (Values & values) const;
+
+  /**
+   * \returns The name of \p counter.
+   */
+  static std::string name (Counter counter);
+
+  /**
+   * \returns Instructions per cycle, or zero without any cycles.
+   */
+  static double ipc (const Values & values);
+
+  /**
+   * \returns The fraction of last level cache references which
+   * missed.
+   */
+  static double cache_miss_rate (const Values & values);
+
+  /**
+   * \returns Branch misses per thousand instructions.
+   */
+  static double branch_mpki (const Values & values);
+
+  /**
+   * \returns The bytes moved from memory per floating point
+   * operation, estimating that every last level cache miss moves one
+   * cache line.
+   */
+  static double bytes_per_flop (const Values & values);
+
+  /**
+   * The cache line size assumed by \p bytes_per_flop().
+   */
+  static const unsigned int cache_line_size = 64;
+
+private:
+
+  /**
+   * The file descriptor of each counter, or -1.
+   */
+  std::array<int, N_COUNTERS> _fd;
+
+  /**
+   * The position of each open counter in the group, or -1.
+   */
+  std::array<int, N_COUNTERS> _position;
+
+  /**
+   * The file descriptor of the first counter opened, which leads the
+   * group read together.
+   */
+  int _group_fd;
+
+  unsigned int _n_open;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_HARDWARE_COUNTERS_H
@@ -0,0 +1,137 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_MEMORY_USAGE_H
+#define LIBMESH_MEMORY_USAGE_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <cstddef>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * Utilities for accounting for memory.
+ *
+ * The \p heap_bytes() functions estimate the heap memory held by
+ * standard containers, for the \p memory_usage() methods of classes
+ * built on them.  They count the storage of the contained values
+ * themselves and the bookkeeping of the container, but nothing the
+ * values point to.  Allocator overhead is ignored.
+ *
+ * The other functions report the memory of the whole process, as the
+ * operating system sees it.
+ */
+namespace MemoryUsage
+{
+
+/**
+ * The estimated bookkeeping of one node of a balanced tree, as used
+ * by std::map and std::set: three pointers and a color, padded.
+ */
+const std::size_t tree_node_overhead = 4*sizeof(void *);
+
+/**
+ * The estimated bookkeeping of one node of a hash table: a pointer to
+ * the next node and a cached hash.
+ */
+const std::size_t hash_node_overhead = 2*sizeof(void *);
+
+template <typename T, typename A>
+std::size_t heap_bytes (const std::vector<T, A> & v)
+{
+  return v.capacity() * sizeof(T);
+}
+
+template <typename K, typename V, typename C, typename A>
+std::size_t heap_bytes (const std::map<K, V, C, A> & m)
+{
+  return m.size() * (sizeof(typename std::map<K, V, C, A>::value_type) +
+                     tree_node_overhead);
+}
+
+template <typename K, typename V, typename C, typename A>
+std::size_t heap_bytes (const std::multimap<K, V, C, A> & m)
+{
+  return m.size() * (sizeof(typename std::multimap<K, V, C, A>::value_type) +
+                     tree_node_overhead);
+}
+
+template <typename K, typename C, typename A>
+std::size_t heap_bytes (const std::set<K, C, A> & s)
+{
+  return s.size() * (sizeof(K) + tree_node_overhead);
+}
+
+template <typename K, typename V, typename H, typename E, typename A>
+std::size_t heap_bytes (const std::unordered_map<K, V, H, E, A> & m)
+{
+  return m.size() * (sizeof(typename std::unordered_map<K, V, H, E, A>::value_type) +
+                     hash_node_overhead) +
+    m.bucket_count() * sizeof(void *);
+}
+
+template <typename K, typename H, typename E, typename A>
+std::size_t heap_bytes (const std::unordered_set<K, H, E, A> & s)
+{
+  return s.size() * (sizeof(K) + hash_node_overhead) +
+    s.bucket_count() * sizeof(void *);
+}
+
+/**
+ * \returns The resident memory of this process in bytes, or zero if
+ * it can't be determined on this system.
+ */
+std::size_t resident_set_size ();
+
+/**
+ * \returns The largest resident memory of this process in bytes,
+ * since it started or since \p reset_peak_resident_set_size() was
+ * last called, or zero if it can't be determined on this system.
+ */
+std::size_t peak_resident_set_size ();
+
+/**
+ * Resets the peak resident memory to the current resident memory,
+ * which Linux supports from version 4.0 on.
+ *
+ * \returns \p true if the peak could be reset.
+ */
+bool reset_peak_resident_set_size ();
+
+/**
+ * \returns \p bytes formatted in the largest fitting binary unit,
+ * e.g. "1.50 GiB".
+ */
+std::string format (std::size_t bytes);
+
+} // namespace MemoryUsage
+
+} // namespace libMesh
+
+#endif // LIBMESH_MEMORY_USAGE_H
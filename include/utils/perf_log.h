@@ -23,12 +23,15 @@
 
 // Local includes
 #include "libmesh/libmesh_common.h"
+#include "libmesh/hardware_counters.h"
+#include "libmesh/perf_tracer.h"
 
 // C++ includes
 #include <cstddef>
 #include <map>
 #include <stack>
 #include <string>
+#include <utility>
 #include <vector>
 #include <sys/time.h>
 
@@ -57,7 +60,11 @@ public:
     tstart_incl_sub(),
     count(0),
     open(false),
-    called_recursively(0)
+    called_recursively(0),
+    counts(),
+    counts_start(),
+    peak_memory(0),
+    memory_increase(0)
   {}
 
 
@@ -104,6 +111,35 @@ public:
 
   int called_recursively;
 
+  /**
+   * The hardware counts in this event, not including sub-events,
+   * if hardware counters are enabled.
+   */
+  HardwareCounters::Values counts;
+
+  /**
+   * The hardware counts when the event was last started or
+   * restarted.
+   */
+  HardwareCounters::Values counts_start;
+
+  /**
+   * Adds the counts since the event was last started or restarted.
+   */
+  void add_counts (const HardwareCounters::Values & counts_now);
+
+  /**
+   * The largest resident memory, in bytes, during any call of this
+   * event including sub-events, if memory tracking is enabled.
+   */
+  std::size_t peak_memory;
+
+  /**
+   * The largest growth of the resident memory, in bytes, from the
+   * start of any call of this event to its peak during that call.
+   */
+  std::size_t memory_increase;
+
 protected:
   double stop_or_pause(const bool do_stop);
 };
@@ -165,6 +201,82 @@ public:
    */
   bool logging_enabled() const { return log_events; }
 
+  /**
+   * Starts tracing every event pushed and popped with \p fast_push()
+   * and \p fast_pop(), including those in threads, where logging is
+   * otherwise disabled.  See \p PerfTracer.
+   */
+  void enable_tracing(std::size_t capacity = 1 << 16)
+  { event_tracer.enable(capacity); }
+
+  /**
+   * Stops tracing events.  The events traced so far are kept.
+   */
+  void disable_tracing() { event_tracer.disable(); }
+
+  /**
+   * \returns \p true iff event tracing is enabled
+   */
+  bool tracing_enabled() const { return event_tracer.enabled(); }
+
+  /**
+   * Starts reading the hardware counters of this thread when events
+   * start and stop, and reporting them for each event.  See
+   * \p HardwareCounters for \p flop_event.
+   *
+   * \note Only the calling thread, normally the main thread, is
+   * counted.  Work that an event hands to other threads, e.g. in
+   * \p Threads::parallel_for(), is missing from its counts, so its
+   * counts and derived metrics describe only the calling thread's
+   * share of the work.  Events are never logged from inside threaded
+   * loops.  A warning is printed if libMesh runs more than one
+   * thread.
+   *
+   * \returns \p true if any counters are available.
+   */
+  bool enable_hardware_counters(std::uint64_t flop_event = 0);
+
+  /**
+   * Stops reading the hardware counters.  The counts so far are kept.
+   */
+  void disable_hardware_counters() { hw_counters.close(); }
+
+  /**
+   * \returns \p true iff hardware counters are read
+   */
+  bool hardware_counters_enabled() const { return hw_counters.enabled(); }
+
+  /**
+   * Starts measuring the resident memory of this process when events
+   * start and stop, and reporting the peak of each event.  Reading
+   * the memory costs a few microseconds, so this is meant for coarse
+   * events.
+   *
+   * On Linux, the peak is reset when each event starts, so that every
+   * event reports its own peak.  This resets the peak reported for
+   * the whole process to other tools, too.  Where the peak can't be
+   * reset, each event reports the peak of the process so far instead.
+   *
+   * \returns \p true if the peak of each event can be measured.
+   */
+  bool enable_memory_tracking();
+
+  /**
+   * Stops measuring the memory.  The peaks so far are kept.
+   */
+  void disable_memory_tracking();
+
+  /**
+   * \returns \p true iff memory tracking is enabled
+   */
+  bool memory_tracking_enabled() const { return track_memory; }
+
+  /**
+   * \returns The tracer holding the traced events.
+   */
+  PerfTracer & tracer() { return event_tracer; }
+  const PerfTracer & tracer() const { return event_tracer; }
+
   /**
    * Push the event \p label onto the stack, pausing any active event.
    *
@@ -267,6 +379,39 @@ public:
    */
   std::string get_perf_info() const;
 
+  /**
+   * \returns A string containing the main thread's hardware counts of
+   * each event and the metrics derived from them, or an empty string
+   * if hardware counters aren't enabled.
+   */
+  std::string get_counter_info() const;
+
+  /**
+   * \returns A string containing the main thread's hardware counts of
+   * each event summed over all processors, with the range of instructions per
+   * cycle among them, on processor 0, and an empty string elsewhere.
+   *
+   * This function must be run on all processors at once.
+   */
+  std::string get_parallel_counter_info(const Parallel::Communicator & comm) const;
+
+  /**
+   * \returns A string containing the peak resident memory and largest
+   * memory increase of each event, or an empty string if memory
+   * tracking isn't enabled.
+   */
+  std::string get_memory_info() const;
+
+  /**
+   * \returns A string containing the largest and average peak memory
+   * of each event over all processors, the processor with the largest
+   * peak and the largest memory increase, on processor 0, and an empty
+   * string elsewhere.
+   *
+   * This function must be run on all processors at once.
+   */
+  std::string get_parallel_memory_info(const Parallel::Communicator & comm) const;
+
   /**
    * Print the log.
    */
@@ -331,6 +476,44 @@ private:
    */
   std::stack<PerfData*> log_stack;
 
+  /**
+   * The trace of every event, when tracing is enabled.
+   */
+  PerfTracer event_tracer;
+
+  /**
+   * The hardware counters, when enabled.
+   */
+  HardwareCounters hw_counters;
+
+  /**
+   * Flag indicating if memory is tracked.
+   */
+  bool track_memory;
+
+  /**
+   * Flag indicating if the peak memory can be reset for each event.
+   */
+  bool reset_memory_peak;
+
+  /**
+   * The resident memory at the start of each running event on the
+   * stack, and the largest resident memory seen in it so far.
+   */
+  std::vector<std::pair<std::size_t, std::size_t>> memory_stack;
+
+  /**
+   * Measures the memory when an event starts, crediting the peak so
+   * far to the running event.
+   */
+  void push_memory();
+
+  /**
+   * Measures the memory when the event \p data stops, crediting its
+   * peak to it and to the event below it.
+   */
+  void pop_memory(PerfData & data);
+
   /**
    * Flag indicating if print_log() has been called.
    * This is used to print a header with machine-specific
@@ -433,6 +616,15 @@ double PerfData::pause_for(PerfData & other)
 
 
 
+inline
+void PerfData::add_counts (const HardwareCounters::Values & counts_now)
+{
+  for (unsigned int c = 0; c != HardwareCounters::N_COUNTERS; ++c)
+    this->counts[c] += counts_now[c] - this->counts_start[c];
+}
+
+
+
 inline
 double PerfData::stopit ()
 {
@@ -451,12 +643,27 @@ inline
 void PerfLog::fast_push (const char * label,
                          const char * header)
 {
+  if (event_tracer.enabled())
+    event_tracer.begin(label, header);
+
   if (this->log_events)
     {
       // Get a reference to the event data to avoid
       // repeated map lookups
       PerfData * perf_data = &(log[std::make_pair(header,label)]);
 
+      if (hw_counters.enabled())
+        {
+          HardwareCounters::Values counts_now;
+          hw_counters.read(counts_now);
+          if (!log_stack.empty())
+            log_stack.top()->add_counts(counts_now);
+          perf_data->counts_start = counts_now;
+        }
+
+      if (track_memory)
+        this->push_memory();
+
       if (!log_stack.empty())
         total_time += log_stack.top()->pause_for(*perf_data);
       else
@@ -468,9 +675,12 @@ void PerfLog::fast_push (const char * label,
 
 
 inline
-void PerfLog::fast_pop(const char * libmesh_dbg_var(label),
-                       const char * libmesh_dbg_var(header))
+void PerfLog::fast_pop(const char * label,
+                       const char * header)
 {
+  if (event_tracer.enabled())
+    event_tracer.end(label, header);
+
   if (this->log_events)
     {
       libmesh_assert (!log_stack.empty());
@@ -489,12 +699,26 @@ void PerfLog::fast_pop(const char * libmesh_dbg_var(label),
         }
 #endif
 
-      total_time += log_stack.top()->stopit();
+      PerfData * top_data = log_stack.top();
+
+      total_time += top_data->stopit();
 
       log_stack.pop();
 
+      if (track_memory)
+        this->pop_memory(*top_data);
+
       if (!log_stack.empty())
         log_stack.top()->restart();
+
+      if (hw_counters.enabled())
+        {
+          HardwareCounters::Values counts_now;
+          hw_counters.read(counts_now);
+          top_data->add_counts(counts_now);
+          if (!log_stack.empty())
+            log_stack.top()->counts_start = counts_now;
+        }
     }
 }
 
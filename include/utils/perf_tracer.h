@@ -0,0 +1,241 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_PERF_TRACER_H
+#define LIBMESH_PERF_TRACER_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+
+// C++ includes
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+namespace Parallel {
+  class Communicator;
+}
+
+/**
+ * The \p PerfTracer records every begin and end of the events logged
+ * by a \p PerfLog, with nanosecond timestamps from a monotonic clock,
+ * so that the full call path of each event is kept rather than only
+ * its total time.
+ *
+ * Each thread records into a ring buffer of its own, without any
+ * locking, so events may be traced from inside threaded loops.  When
+ * a buffer is full the oldest events are overwritten; see
+ * \p n_dropped().  Buffers are reused by later threads once their
+ * thread exits, so the number of buffers stays bounded by the number
+ * of threads running at once.
+ *
+ * The recorded events can be written in the JSON format of the
+ * Chrome trace viewer (chrome://tracing) and Perfetto, one process
+ * per MPI rank and one track per thread, or summarized by call path
+ * and across processors.
+ *
+ * Events must be recorded between \p enable() and \p disable(), and
+ * the recorded events may only be read or cleared while no other
+ * thread is recording.
+ *
+ * \brief Per-thread event tracer for PerfLog.
+ */
+class PerfTracer
+{
+public:
+
+  /**
+   * Constructor.  Tracing is disabled until \p enable() is called.
+   */
+  PerfTracer ();
+
+  /**
+   * Destructor.
+   */
+  ~PerfTracer ();
+
+  /**
+   * Starts tracing, with room for \p capacity events per thread.
+   * Any previously recorded events are discarded.
+   */
+  void enable (std::size_t capacity = 1 << 16);
+
+  /**
+   * Stops tracing.  Recorded events are kept.
+   */
+  void disable ();
+
+  /**
+   * \returns \p true iff tracing is enabled.
+   */
+  bool enabled () const
+  { return _enabled.load(std::memory_order_relaxed); }
+
+  /**
+   * Discards all recorded events.
+   */
+  void clear ();
+
+  /**
+   * Records the beginning of event \p label on this thread.  As with
+   * \p PerfLog::fast_push(), the pointers themselves are stored, and
+   * must outlive the tracer.
+   */
+  void begin (const char * label,
+              const char * header);
+
+  /**
+   * Records the end of event \p label on this thread.
+   */
+  void end (const char * label,
+            const char * header);
+
+  /**
+   * \returns The number of events overwritten because a buffer was
+   * full.
+   */
+  std::size_t n_dropped () const;
+
+  /**
+   * Prints the recorded events of this processor in Chrome trace
+   * JSON format, as process \p pid.
+   */
+  void print_chrome_trace (std::ostream & os,
+                           processor_id_type pid = 0) const;
+
+  /**
+   * Writes the recorded events of every processor to \p filename in
+   * Chrome trace JSON format, one process per rank.  Timestamps are
+   * aligned across processors by a barrier.
+   *
+   * This function must be run on all processors at once.
+   */
+  void write_chrome_trace (const Parallel::Communicator & comm,
+                           const std::string & filename) const;
+
+  /**
+   * \returns A tree of every call path recorded on this processor,
+   * with the number of calls and the inclusive and exclusive time
+   * spent in it, summed over threads.
+   */
+  std::string get_call_path_summary () const;
+
+  /**
+   * \returns A table of the time spent in each event, with its
+   * minimum, maximum and average over processors and the imbalance,
+   * the ratio of the maximum to the average.  The table is returned
+   * on processor 0, and an empty string elsewhere.
+   *
+   * This function must be run on all processors at once.
+   */
+  std::string get_parallel_summary (const Parallel::Communicator & comm) const;
+
+private:
+
+  /**
+   * One recorded begin or end.
+   */
+  struct Event
+  {
+    const char * label;
+    const char * header;
+    std::uint64_t time;
+    bool begin;
+  };
+
+  /**
+   * The ring buffer of one thread.  Only its owning thread writes to
+   * it.
+   */
+  struct ThreadBuffer
+  {
+    std::vector<Event> events;
+    std::atomic<std::size_t> n_recorded;
+    std::atomic<bool> in_use;
+  };
+
+  /**
+   * \returns The buffer of this thread, acquiring one if needed.
+   */
+  ThreadBuffer & thread_buffer ();
+
+  /**
+   * \returns The nanoseconds since tracing was enabled.
+   */
+  std::uint64_t now () const;
+
+  /**
+   * Records an event on this thread.
+   */
+  void record (const char * label,
+               const char * header,
+               bool begin);
+
+  /**
+   * \returns The events still held by \p buffer in the order they
+   * were recorded, without any ends whose beginnings were dropped.
+   */
+  static std::vector<Event> events (const ThreadBuffer & buffer);
+
+  /**
+   * Prints the events of this processor as Chrome trace JSON
+   * objects, shifting their timestamps by \p offset nanoseconds.
+   */
+  void print_chrome_events (std::ostream & os,
+                            processor_id_type pid,
+                            std::int64_t offset) const;
+
+  std::atomic<bool> _enabled;
+
+  std::size_t _capacity;
+
+  /**
+   * Identifies this tracer and its current set of buffers to the
+   * threads which have cached one of them.
+   */
+  std::uint64_t _id;
+
+  /**
+   * The time tracing was enabled.
+   */
+  std::uint64_t _epoch;
+
+  /**
+   * Every buffer, indexed as threads are listed in traces.
+   */
+  std::vector<std::shared_ptr<ThreadBuffer>> _buffers;
+
+  /**
+   * Guards \p _buffers while threads acquire buffers.
+   */
+  std::mutex _buffers_mutex;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_PERF_TRACER_H
@@ -0,0 +1,249 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2020 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_POINT_LOCATOR_BVH_H
+#define LIBMESH_POINT_LOCATOR_BVH_H
+
+// Local Includes
+#include "libmesh/point_locator_base.h"
+#include "libmesh/tree_base.h"
+
+// C++ includes
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class MeshBase;
+class Point;
+class Elem;
+
+/**
+ * This is a point locator based on a bounding volume hierarchy.
+ * Unlike the \p TreeNode based octree used by \p PointLocatorTree,
+ * every element is stored exactly once, and the whole hierarchy
+ * lives in a few contiguous arrays: a depth-first array of nodes
+ * (the left child of an interior node immediately follows its
+ * parent) and a Morton-ordered array of element pointers with their
+ * bounding boxes interleaved alongside.  The hierarchy is bulk
+ * loaded by sorting element bounding box centroids along a Morton
+ * (Z-order) curve and splitting each range at its highest differing
+ * Morton bit, and queries walk it iteratively with an explicit
+ * stack.
+ *
+ * Use \p PointLocatorBase::build() with the \p BVH or
+ * \p BVH_LOCAL_ELEMENTS types to create objects of this type at run
+ * time.
+ */
+class PointLocatorBVH : public PointLocatorBase
+{
+public:
+  /**
+   * Constructor.  Needs the \p mesh in which the points should be
+   * located.  Optionally takes a master locator; only the master
+   * locator holds a hierarchy, servants simply use the master's.
+   */
+  PointLocatorBVH (const MeshBase & mesh,
+                   const PointLocatorBase * master = nullptr);
+
+  /**
+   * Constructor.  As above, but allows the user to specify whether
+   * all active elements (\p Trees::ELEMENTS or \p Trees::NODES) or
+   * only active local elements (\p Trees::LOCAL_ELEMENTS) should be
+   * inserted into the hierarchy.
+   */
+  PointLocatorBVH (const MeshBase & mesh,
+                   const Trees::BuildType build_type,
+                   const PointLocatorBase * master = nullptr);
+
+  /**
+   * Destructor.
+   */
+  ~PointLocatorBVH ();
+
+  /**
+   * Clears the locator.
+   */
+  virtual void clear() override;
+
+  /**
+   * Initializes the locator, so that the \p operator() methods can
+   * be used.
+   */
+  virtual void init() override;
+
+  /**
+   * Locates the element in which the point with global coordinates
+   * \p p is located, optionally restricted to a set of allowed
+   * subdomains.  The result is cached and checked first during the
+   * next call to operator().
+   */
+  virtual const Elem * operator() (const Point & p,
+                                   const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const override;
+
+  /**
+   * Locates a set of elements in proximity to the point with global
+   * coordinates \p p.  Optionally allows the user to restrict the
+   * subdomains searched.
+   */
+  virtual void operator() (const Point & p,
+                           std::set<const Elem *> & candidate_elements,
+                           const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const override;
+
+  /**
+   * Enables out-of-mesh mode.  In this mode, if asked to find a point
+   * that is contained in no mesh at all, the point locator will
+   * return nullptr instead of crashing.  Per default, this
+   * mode is off.
+   */
+  virtual void enable_out_of_mesh_mode () override;
+
+  /**
+   * Disables out-of-mesh mode (default).  If asked to find a point
+   * that is contained in no mesh at all, the point locator will now
+   * crash.
+   */
+  virtual void disable_out_of_mesh_mode () override;
+
+  /**
+   * Set the maximum number of elements stored in a leaf of the
+   * hierarchy.  Takes effect the next time the hierarchy is built,
+   * i.e. after a clear() and init().
+   */
+  void set_target_leaf_size(unsigned int target);
+
+  /**
+   * Get the maximum number of elements stored in a leaf of the
+   * hierarchy.
+   */
+  unsigned int get_target_leaf_size() const;
+
+  /**
+   * \returns The number of nodes in the hierarchy, or 0 if the
+   * locator has not been initialized.
+   */
+  std::size_t n_bvh_nodes() const;
+
+protected:
+  /**
+   * A node of the flattened hierarchy.  For leaves, \p first is the
+   * offset of the leaf's first element in the element arrays; for
+   * interior nodes (\p n_elem == 0) the left child is the next node
+   * and \p first is the index of the right child.
+   */
+  struct Node
+  {
+    Real lower[LIBMESH_DIM];
+    Real upper[LIBMESH_DIM];
+
+    /**
+     * The largest bounding box diagonal of any element below this
+     * node, used to scale relative tolerances conservatively.
+     */
+    Real max_diag;
+
+    unsigned int first;
+    unsigned int n_elem;
+  };
+
+  /**
+   * The flattened hierarchy.  Owned by the master locator and shared
+   * read-only with servants.
+   */
+  struct Hierarchy
+  {
+    std::vector<Node> nodes;
+
+    /**
+     * Elements in hierarchy (Morton) order.
+     */
+    std::vector<const Elem *> elems;
+
+    /**
+     * Element bounding boxes in the same order as \p elems, stored
+     * as \p bounds_stride Reals per element: lower corner, upper
+     * corner, and bounding box diagonal length.
+     */
+    std::vector<Real> elem_bounds;
+
+    /**
+     * Elements (infinite elements) which have no finite bounding
+     * box, and which are therefore always tested.
+     */
+    std::vector<const Elem *> unbounded_elems;
+  };
+
+  static const unsigned int bounds_stride = 2*LIBMESH_DIM + 1;
+
+  /**
+   * Calls \p visit(elem) for every element in the hierarchy whose
+   * bounding box, enlarged by \p relative_tol times its diagonal,
+   * contains \p p.  Stops and returns \p true as soon as a call to
+   * \p visit returns \p true.
+   */
+  template <typename Visitor>
+  bool visit_candidates (const Point & p,
+                         Real relative_tol,
+                         Visitor visit) const;
+
+  /**
+   * Bulk loads the hierarchy from the elements of the mesh.
+   */
+  void build_hierarchy ();
+
+  /**
+   * The hierarchy built by a master locator.
+   */
+  std::unique_ptr<Hierarchy> _owned_hierarchy;
+
+  /**
+   * The hierarchy this locator searches.  For servant locators this
+   * points to the master's hierarchy.
+   */
+  const Hierarchy * _hierarchy;
+
+  /**
+   * Pointer to the last element that was found.  Chances are that
+   * this may be close to the next call to \p operator()...
+   */
+  mutable const Elem * _element;
+
+  /**
+   * \p true if out-of-mesh mode is enabled.  See \p
+   * enable_out_of_mesh_mode() for details.
+   */
+  bool _out_of_mesh_mode;
+
+  /**
+   * Maximum number of elements per leaf.
+   */
+  unsigned int _target_leaf_size;
+
+  /**
+   * Which elements are inserted into the hierarchy.
+   */
+  Trees::BuildType _build_type;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_POINT_LOCATOR_BVH_H
@@ -193,6 +193,9 @@ AC_CHECK_DECLS([_mkdir], [], [], [
 # Check for uname header.
 AC_CHECK_HEADERS(sys/utsname.h)
 
+# Check for the Linux hardware performance counter interface.
+AC_CHECK_HEADERS(linux/perf_event.h)
+
 AC_ARG_ENABLE(unordered-containers,
               AS_HELP_STRING([--disable-unordered-containers],
                              [Use map/set instead of unordered_map/unordered_set (no longer supported)]),